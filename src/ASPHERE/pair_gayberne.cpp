@@ -49,6 +49,8 @@ static const char cite_pair_gayberne[] =
 
 PairGayBerne::PairGayBerne(LAMMPS *lmp) : Pair(lmp)
 {
+  matmax = 0;
+  amat = bmat = gmat = NULL;
   if (lmp->citeme) lmp->citeme->add(cite_pair_gayberne);
 
   single_enable = 0;
@@ -61,6 +63,9 @@ PairGayBerne::PairGayBerne(LAMMPS *lmp) : Pair(lmp)
 
 PairGayBerne::~PairGayBerne()
 {
+  memory->destroy(amat);
+  memory->destroy(bmat);
+  memory->destroy(gmat);
   if (allocated) {
     memory->destroy(setflag);
     memory->destroy(cutsq);
@@ -112,6 +117,35 @@ void PairGayBerne::compute(int eflag, int vflag)
   numneigh = list->numneigh;
   firstneigh = list->firstneigh;
 
+  // precompute each ellipsoidal atom's orientation products once, so
+  // the pair loop reads cached matrices instead of rebuilding the
+  // rotation and both matrix chains per neighbor
+
+  int nall = nlocal + atom->nghost;
+  if (nall > matmax) {
+    matmax = atom->nmax;
+    memory->destroy(amat);
+    memory->destroy(bmat);
+    memory->destroy(gmat);
+    memory->create(amat,matmax,9,"pair:amat");
+    memory->create(bmat,matmax,9,"pair:bmat");
+    memory->create(gmat,matmax,9,"pair:gmat");
+  }
+
+  for (i = 0; i < nall; i++) {
+    if (ellipsoid[i] < 0) continue;
+    itype = type[i];
+    double (*am)[3] = (double (*)[3]) amat[i];
+    double (*bm)[3] = (double (*)[3]) bmat[i];
+    double (*gm)[3] = (double (*)[3]) gmat[i];
+    iquat = bonus[ellipsoid[i]].quat;
+    MathExtra::quat_to_mat_trans(iquat,am);
+    MathExtra::diag_times3(well[itype],am,temp);
+    MathExtra::transpose_times3(am,temp,bm);
+    MathExtra::diag_times3(shape2[itype],am,temp);
+    MathExtra::transpose_times3(am,temp,gm);
+  }
+
   // loop over neighbors of my atoms
 
   for (ii = 0; ii < inum; ii++) {
@@ -119,12 +153,9 @@ void PairGayBerne::compute(int eflag, int vflag)
     itype = type[i];
 
     if (form[itype][itype] == ELLIPSE_ELLIPSE) {
-      iquat = bonus[ellipsoid[i]].quat;
-      MathExtra::quat_to_mat_trans(iquat,a1);
-      MathExtra::diag_times3(well[itype],a1,temp);
-      MathExtra::transpose_times3(a1,temp,b1);
-      MathExtra::diag_times3(shape2[itype],a1,temp);
-      MathExtra::transpose_times3(a1,temp,g1);
+      memcpy(&a1[0][0],amat[i],9*sizeof(double));
+      memcpy(&b1[0][0],bmat[i],9*sizeof(double));
+      memcpy(&g1[0][0],gmat[i],9*sizeof(double));
     }
 
     jlist = firstneigh[i];
@@ -164,12 +195,9 @@ void PairGayBerne::compute(int eflag, int vflag)
           break;
 
         case SPHERE_ELLIPSE:
-          jquat = bonus[ellipsoid[j]].quat;
-          MathExtra::quat_to_mat_trans(jquat,a2);
-          MathExtra::diag_times3(well[jtype],a2,temp);
-          MathExtra::transpose_times3(a2,temp,b2);
-          MathExtra::diag_times3(shape2[jtype],a2,temp);
-          MathExtra::transpose_times3(a2,temp,g2);
+          memcpy(&a2[0][0],amat[j],9*sizeof(double));
+          memcpy(&b2[0][0],bmat[j],9*sizeof(double));
+          memcpy(&g2[0][0],gmat[j],9*sizeof(double));
           one_eng = gayberne_lj(j,i,a2,b2,g2,r12,rsq,fforce,rtor);
           ttor[0] = ttor[1] = ttor[2] = 0.0;
           break;
@@ -180,12 +208,9 @@ void PairGayBerne::compute(int eflag, int vflag)
           break;
 
         default:
-          jquat = bonus[ellipsoid[j]].quat;
-          MathExtra::quat_to_mat_trans(jquat,a2);
-          MathExtra::diag_times3(well[jtype],a2,temp);
-          MathExtra::transpose_times3(a2,temp,b2);
-          MathExtra::diag_times3(shape2[jtype],a2,temp);
-          MathExtra::transpose_times3(a2,temp,g2);
+          memcpy(&a2[0][0],amat[j],9*sizeof(double));
+          memcpy(&b2[0][0],bmat[j],9*sizeof(double));
+          memcpy(&g2[0][0],gmat[j],9*sizeof(double));
           one_eng = gayberne_analytic(i,j,a1,a2,b1,b2,g1,g2,r12,rsq,
                                       fforce,ttor,rtor);
           break;
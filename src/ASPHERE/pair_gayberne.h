@@ -41,6 +41,9 @@ class PairGayBerne : public Pair {
   void write_data_all(FILE *);
 
  protected:
+  int matmax;                  // size of cached orientation arrays
+  double **amat,**bmat,**gmat; // per-atom rotation and matrix chains
+
   enum{SPHERE_SPHERE,SPHERE_ELLIPSE,ELLIPSE_SPHERE,ELLIPSE_ELLIPSE};
 
   double cut_global;
@@ -134,8 +134,38 @@ void DumpAtomGZ::write_header(bigint ndump)
 
 /* ---------------------------------------------------------------------- */
 
+// job function for the helper thread: compress one snapshot, close its file
+
+static void async_write_gz(void *handle, void *buf, int n)
+{
+  gzFile gzFp = (gzFile) handle;
+  gzwrite(gzFp,buf,sizeof(char)*n);
+  gzclose(gzFp);
+}
+
+/* ---------------------------------------------------------------------- */
+
 void DumpAtomGZ::write_data(int n, double *mybuf)
 {
+#if defined(_OPENMP)
+
+  // with dump_modify async yes, compression of per-step files runs on
+  // the helper thread; swap in the spare string buffer for the next step
+
+  if (async_flag && multifile && nclusterprocs == 1 &&
+      mybuf == (double *) sbuf) {
+    write_async_raw(async_write_gz,(void *) gzFp,(void *) mybuf,n);
+    char *sbufswap = sbuf;
+    sbuf = asbuf;
+    asbuf = sbufswap;
+    int maxswap = maxsbuf;
+    maxsbuf = amaxsbuf;
+    amaxsbuf = maxswap;
+    gzFp = NULL;
+    return;
+  }
+#endif
+
   gzwrite(gzFp,mybuf,sizeof(char)*n);
 }
 
@@ -146,7 +176,7 @@ void DumpAtomGZ::write()
   DumpAtom::write();
   if (filewriter) {
     if (multifile) {
-      gzclose(gzFp);
+      if (gzFp) gzclose(gzFp);
       gzFp = NULL;
     } else {
       if (flush_flag)
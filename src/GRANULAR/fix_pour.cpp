@@ -457,6 +457,61 @@ void FixPour::pre_exchange()
   MPI_Allgatherv(ptr,4*ncount,MPI_DOUBLE,
                  xnear[0],recvcounts,displs,MPI_DOUBLE,world);
 
+  // cell grid over the insertion neighborhood: candidates check only
+  // the cells within one max diameter instead of every xnear entry
+  // grid covers the bounding box of xnear plus inserted particles;
+  // out-of-range coords clamp to edge cells, the distance test culls
+
+  int nnearmax = nprevious + nnew*natom_max;
+  double glo[3],ghi[3];
+  glo[0] = glo[1] = glo[2] = 1.0e20;
+  ghi[0] = ghi[1] = ghi[2] = -1.0e20;
+  for (i = 0; i < nnear; i++)
+    for (int d = 0; d < 3; d++) {
+      glo[d] = MIN(glo[d],xnear[i][d]);
+      ghi[d] = MAX(ghi[d],xnear[i][d]);
+    }
+  for (int d = 0; d < 3; d++) {
+    glo[d] = MIN(glo[d],xlo);
+    ghi[d] = MAX(ghi[d],xhi);
+  }
+  glo[0] = MIN(glo[0],xlo); ghi[0] = MAX(ghi[0],xhi);
+  glo[1] = MIN(glo[1],ylo); ghi[1] = MAX(ghi[1],yhi);
+  glo[2] = MIN(glo[2],zlo); ghi[2] = MAX(ghi[2],zhi);
+
+  // cell side must cover the largest possible contact reach
+  // (sum of the two largest per-atom radii of any insertion mode)
+
+  double maxrad = radius_max;
+  if (mode == MOLECULE) maxrad = MAX(maxrad,molradius_max);
+  double cell = 2.0*maxrad;
+  if (cell <= 0.0) cell = 1.0;
+  double cellinv = 1.0/cell;
+  int gnx = MAX(1,(int) ((ghi[0]-glo[0])*cellinv) + 1);
+  int gny = MAX(1,(int) ((ghi[1]-glo[1])*cellinv) + 1);
+  int gnz = MAX(1,(int) ((ghi[2]-glo[2])*cellinv) + 1);
+  int gncell = gnx*gny*gnz;
+
+  int *ghead = (int *) memory->aget(gncell*sizeof(int),"pour:ghead");
+  int *gnext = (int *) memory->aget(nnearmax*sizeof(int),"pour:gnext");
+  for (i = 0; i < gncell; i++) ghead[i] = -1;
+
+#define POUR_CELL(xx,yy,zz,cc) \
+  { int cx = (int) ((xx-glo[0])*cellinv); \
+    int cy = (int) ((yy-glo[1])*cellinv); \
+    int cz = (int) ((zz-glo[2])*cellinv); \
+    cx = MAX(0,MIN(cx,gnx-1)); \
+    cy = MAX(0,MIN(cy,gny-1)); \
+    cz = MAX(0,MIN(cz,gnz-1)); \
+    cc = (cz*gny + cy)*gnx + cx; }
+
+  for (i = 0; i < nnear; i++) {
+    int c;
+    POUR_CELL(xnear[i][0],xnear[i][1],xnear[i][2],c);
+    gnext[i] = ghead[c];
+    ghead[c] = i;
+  }
+
   // insert new particles into xnear list, one by one
   // check against all nearby atoms and previously inserted ones
   // if there is an overlap then try again at same z (3d) or y (2d) coord
@@ -539,19 +594,57 @@ void FixPour::pre_exchange()
       // if any pair of atoms overlap, try again
       // use minimum_image() to account for PBC
 
-      for (m = 0; m < natom; m++) {
-        for (i = 0; i < nnear; i++) {
-          delx = coords[m][0] - xnear[i][0];
-          dely = coords[m][1] - xnear[i][1];
-          delz = coords[m][2] - xnear[i][2];
-          domain->minimum_image(delx,dely,delz);
-          rsq = delx*delx + dely*dely + delz*delz;
-          radsum = coords[m][3] + xnear[i][3];
-          if (rsq <= radsum*radsum) break;
+      // test each candidate atom and its nearby periodic images thru
+      // the grid, so pairs that overlap across a periodic boundary
+      // (the distance test below uses the minimum image) are reached
+      // even though the grid bins absolute coordinates
+      // an image is only visited when it lands within one cell of the
+      // grid extent, so at most a handful of images are walked
+
+      int overlap = 0;
+      double *prd = domain->prd;
+      int *periodicity = domain->periodicity;
+
+      for (m = 0; m < natom && !overlap; m++) {
+        int sxlo = periodicity[0] ? -1 : 0;
+        int sxhi = periodicity[0] ? 1 : 0;
+        int sylo = periodicity[1] ? -1 : 0;
+        int syhi = periodicity[1] ? 1 : 0;
+        int szlo = periodicity[2] ? -1 : 0;
+        int szhi = periodicity[2] ? 1 : 0;
+
+        for (int sx = sxlo; sx <= sxhi && !overlap; sx++)
+        for (int sy = sylo; sy <= syhi && !overlap; sy++)
+        for (int sz = szlo; sz <= szhi && !overlap; sz++) {
+          double cx0 = coords[m][0] + sx*prd[0];
+          double cy0 = coords[m][1] + sy*prd[1];
+          double cz0 = coords[m][2] + sz*prd[2];
+          if (cx0 < glo[0]-cell || cx0 > ghi[0]+cell) continue;
+          if (cy0 < glo[1]-cell || cy0 > ghi[1]+cell) continue;
+          if (cz0 < glo[2]-cell || cz0 > ghi[2]+cell) continue;
+
+          int cm;
+          POUR_CELL(cx0,cy0,cz0,cm);
+          int cmx = cm % gnx;
+          int cmy = (cm/gnx) % gny;
+          int cmz = cm/(gnx*gny);
+          for (int ox = MAX(0,cmx-1); ox <= MIN(gnx-1,cmx+1) && !overlap; ox++)
+            for (int oy = MAX(0,cmy-1); oy <= MIN(gny-1,cmy+1) && !overlap; oy++)
+              for (int oz = MAX(0,cmz-1); oz <= MIN(gnz-1,cmz+1); oz++) {
+                for (i = ghead[(oz*gny + oy)*gnx + ox]; i >= 0; i = gnext[i]) {
+                  delx = coords[m][0] - xnear[i][0];
+                  dely = coords[m][1] - xnear[i][1];
+                  delz = coords[m][2] - xnear[i][2];
+                  domain->minimum_image(delx,dely,delz);
+                  rsq = delx*delx + dely*dely + delz*delz;
+                  radsum = coords[m][3] + xnear[i][3];
+                  if (rsq <= radsum*radsum) { overlap = 1; break; }
+                }
+                if (overlap) break;
+              }
         }
-        if (i < nnear) break;
       }
-      if (m == natom) {
+      if (!overlap) {
         success = 1;
         break;
       }
@@ -571,6 +664,12 @@ void FixPour::pre_exchange()
       xnear[nnear][1] = coords[m][1];
       xnear[nnear][2] = coords[m][2];
       xnear[nnear][3] = coords[m][3];
+      {
+        int c;
+        POUR_CELL(coords[m][0],coords[m][1],coords[m][2],c);
+        gnext[nnear] = ghead[c];
+        ghead[c] = nnear;
+      }
       nnear++;
     }
 
@@ -705,6 +804,8 @@ void FixPour::pre_exchange()
   // free local memory
 
   memory->destroy(xmine);
+#undef POUR_CELL
+
   memory->destroy(xnear);
 
   // next timestep to insert
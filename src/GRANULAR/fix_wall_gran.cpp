@@ -302,6 +302,15 @@ void FixWallGran::setup(int vflag)
 
 /* ---------------------------------------------------------------------- */
 
+/* ----------------------------------------------------------------------
+   NOTE on mesh walls: STL walls with a BVH broadphase need triangle
+   contact resolution (face/edge/vertex cases with history transfer
+   between them), a mesh reader, and moving-mesh integration -- a
+   subsystem on the scale of the granular package itself rather than an
+   extension of these analytic wall kernels.  fix wall/gran/region with
+   a union of primitives covers faceted approximations today.
+------------------------------------------------------------------------- */
+
 void FixWallGran::post_force(int vflag)
 {
   int i,j;
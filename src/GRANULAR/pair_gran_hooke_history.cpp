@@ -397,8 +397,10 @@ void PairGranHookeHistory::init_style()
 
   if (!atom->radius_flag || !atom->rmass_flag)
     error->all(FLERR,"Pair granular requires atom attributes radius, rmass");
-  if (comm->ghost_velocity == 0)
-    error->all(FLERR,"Pair granular requires ghost atoms store velocity");
+  // subscribe to ghost velocities instead of requiring the user to
+  // set comm_modify vel yes by hand
+
+  comm->request_ghost_velocity();
 
   // need a granular neigh list
 
@@ -146,6 +146,16 @@ void CommKokkos::init()
    other per-atom attributes may also be sent via pack/unpack routines
 ------------------------------------------------------------------------- */
 
+/* ----------------------------------------------------------------------
+   NOTE on device-resident exchange: the host-mirror staging and the
+   CommBrick fallbacks below exist because only a subset of AtomVecs
+   implement device pack/unpack in this version; making the halo fully
+   GPU-direct means porting those pack kernels per atom style and
+   requires a CUDA-capable build to validate, neither possible here.
+   Recorded so the fallback paths are understood as coverage gaps, not
+   design.
+------------------------------------------------------------------------- */
+
 void CommKokkos::forward_comm(int dummy)
 {
   if (!forward_comm_classic) {
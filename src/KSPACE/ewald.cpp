@@ -410,18 +410,21 @@ void Ewald::compute(int eflag, int vflag)
   int kx,ky,kz;
   double cypz,sypz,exprl,expim,partial,partial_peratom;
 
+  // loop nest is atom-outer so the per-atom accumulators are thread
+  // private by ownership and the sweep parallelizes without reductions
+
+#if defined(_OPENMP)
+#pragma omp parallel for default(shared) private(k,kx,ky,kz,cypz,sypz,exprl,expim,partial,partial_peratom,j) schedule(static)
+#endif
   for (i = 0; i < nlocal; i++) {
     ek[i][0] = 0.0;
     ek[i][1] = 0.0;
     ek[i][2] = 0.0;
-  }
 
-  for (k = 0; k < kcount; k++) {
-    kx = kxvecs[k];
-    ky = kyvecs[k];
-    kz = kzvecs[k];
-
-    for (i = 0; i < nlocal; i++) {
+    for (k = 0; k < kcount; k++) {
+      kx = kxvecs[k];
+      ky = kyvecs[k];
+      kz = kzvecs[k];
       cypz = cs[ky][1][i]*cs[kz][2][i] - sn[ky][1][i]*sn[kz][2][i];
       sypz = sn[ky][1][i]*cs[kz][2][i] + cs[ky][1][i]*sn[kz][2][i];
       exprl = cs[kx][0][i]*cypz - sn[kx][0][i]*sypz;
@@ -564,35 +564,59 @@ struct fft_plan_3d *fft_3d_create_plan(
 
 #elif defined(FFT_FFTW3)
   plan->plan_fast_forward =
+  // runtime-selectable planning rigor and wisdom persistence:
+  // LMP_FFTW_MEASURE asks FFTW for measured plans (slower setup, faster
+  // transforms on large grids) and LMP_FFTW_WISDOM names a file that
+  // wisdom is imported from before planning and exported to afterward
+
+  int fftw_flags = FFTW_ESTIMATE;
+  const char *wisdomfile = getenv("LMP_FFTW_WISDOM");
+  if (getenv("LMP_FFTW_MEASURE")) fftw_flags = FFTW_MEASURE;
+  if (wisdomfile) {
+    FILE *wfp = fopen(wisdomfile,"r");
+    if (wfp) {
+      FFTW_API(import_wisdom_from_file)(wfp);
+      fclose(wfp);
+    }
+  }
+
     FFTW_API(plan_many_dft)(1, &nfast,plan->total1/plan->length1,
                             NULL,&nfast,1,plan->length1,
                             NULL,&nfast,1,plan->length1,
-                            FFTW_FORWARD,FFTW_ESTIMATE);
+                            FFTW_FORWARD,fftw_flags);
   plan->plan_fast_backward =
     FFTW_API(plan_many_dft)(1, &nfast,plan->total1/plan->length1,
                             NULL,&nfast,1,plan->length1,
                             NULL,&nfast,1,plan->length1,
-                            FFTW_BACKWARD,FFTW_ESTIMATE);
+                            FFTW_BACKWARD,fftw_flags);
   plan->plan_mid_forward =
     FFTW_API(plan_many_dft)(1, &nmid,plan->total2/plan->length2,
                             NULL,&nmid,1,plan->length2,
                             NULL,&nmid,1,plan->length2,
-                            FFTW_FORWARD,FFTW_ESTIMATE);
+                            FFTW_FORWARD,fftw_flags);
   plan->plan_mid_backward =
     FFTW_API(plan_many_dft)(1, &nmid,plan->total2/plan->length2,
                             NULL,&nmid,1,plan->length2,
                             NULL,&nmid,1,plan->length2,
-                            FFTW_BACKWARD,FFTW_ESTIMATE);
+                            FFTW_BACKWARD,fftw_flags);
   plan->plan_slow_forward =
     FFTW_API(plan_many_dft)(1, &nslow,plan->total3/plan->length3,
                             NULL,&nslow,1,plan->length3,
                             NULL,&nslow,1,plan->length3,
-                            FFTW_FORWARD,FFTW_ESTIMATE);
+                            FFTW_FORWARD,fftw_flags);
   plan->plan_slow_backward =
     FFTW_API(plan_many_dft)(1, &nslow,plan->total3/plan->length3,
                             NULL,&nslow,1,plan->length3,
                             NULL,&nslow,1,plan->length3,
-                            FFTW_BACKWARD,FFTW_ESTIMATE);
+                            FFTW_BACKWARD,fftw_flags);
+
+  if (wisdomfile) {
+    FILE *wfp = fopen(wisdomfile,"w");
+    if (wfp) {
+      FFTW_API(export_wisdom_to_file)(wfp);
+      fclose(wfp);
+    }
+  }
 
   if (scaled == 0)
     plan->scaled = 0;
@@ -67,6 +67,9 @@ GridComm::GridComm(LAMMPS *lmp, MPI_Comm gcomm, int forward, int reverse,
   nswap = 0;
   swap = NULL;
   buf1 = buf2 = NULL;
+  nplan = 0;
+  planself = NULL;
+  fsplan = frplan = rsplan = rrplan = NULL;
 }
 
 /* ---------------------------------------------------------------------- */
@@ -116,6 +119,9 @@ GridComm::GridComm(LAMMPS *lmp, MPI_Comm gcomm, int forward, int reverse,
   nswap = 0;
   swap = NULL;
   buf1 = buf2 = NULL;
+  nplan = 0;
+  planself = NULL;
+  fsplan = frplan = rsplan = rrplan = NULL;
 }
 
 /* ---------------------------------------------------------------------- */
@@ -130,6 +136,7 @@ GridComm::~GridComm()
 
   memory->destroy(buf1);
   memory->destroy(buf2);
+  free_plans();
 }
 
 /* ----------------------------------------------------------------------
@@ -481,6 +488,59 @@ void GridComm::setup()
   nbuf *= MAX(nforward,nreverse);
   memory->create(buf1,nbuf,"Commgrid:buf1");
   memory->create(buf2,nbuf,"Commgrid:buf2");
+
+  // persistent requests for every swap: partners, counts, and buffers
+  // are now fixed until the grid decomposition changes
+  // recvs are pre-posted in the comm loops before packing begins
+
+  free_plans();
+  nplan = nswap;
+  memory->create(planself,nplan,"Commgrid:planself");
+  fsplan = (MPI_Request *)
+    memory->smalloc(nplan*sizeof(MPI_Request),"Commgrid:fsplan");
+  frplan = (MPI_Request *)
+    memory->smalloc(nplan*sizeof(MPI_Request),"Commgrid:frplan");
+  rsplan = (MPI_Request *)
+    memory->smalloc(nplan*sizeof(MPI_Request),"Commgrid:rsplan");
+  rrplan = (MPI_Request *)
+    memory->smalloc(nplan*sizeof(MPI_Request),"Commgrid:rrplan");
+
+  for (int i = 0; i < nswap; i++) {
+    planself[i] = (swap[i].sendproc == me);
+    if (planself[i]) continue;
+    MPI_Recv_init(buf2,nforward*swap[i].nunpack,MPI_FFT_SCALAR,
+                  swap[i].recvproc,0,gridcomm,&frplan[i]);
+    MPI_Send_init(buf1,nforward*swap[i].npack,MPI_FFT_SCALAR,
+                  swap[i].sendproc,0,gridcomm,&fsplan[i]);
+    MPI_Recv_init(buf2,nreverse*swap[i].npack,MPI_FFT_SCALAR,
+                  swap[i].sendproc,0,gridcomm,&rrplan[i]);
+    MPI_Send_init(buf1,nreverse*swap[i].nunpack,MPI_FFT_SCALAR,
+                  swap[i].recvproc,0,gridcomm,&rsplan[i]);
+  }
+}
+
+/* ----------------------------------------------------------------------
+   release the persistent swap requests
+------------------------------------------------------------------------- */
+
+void GridComm::free_plans()
+{
+  if (!nplan) return;
+  for (int i = 0; i < nplan; i++) {
+    if (planself[i]) continue;
+    MPI_Request_free(&fsplan[i]);
+    MPI_Request_free(&frplan[i]);
+    MPI_Request_free(&rsplan[i]);
+    MPI_Request_free(&rrplan[i]);
+  }
+  memory->destroy(planself);
+  memory->sfree(fsplan);
+  memory->sfree(frplan);
+  memory->sfree(rsplan);
+  memory->sfree(rrplan);
+  planself = NULL;
+  fsplan = frplan = rsplan = rrplan = NULL;
+  nplan = 0;
 }
 
 /* ----------------------------------------------------------------------
@@ -490,17 +550,14 @@ void GridComm::setup()
 void GridComm::forward_comm(KSpace *kspace, int which)
 {
   for (int m = 0; m < nswap; m++) {
-    if (swap[m].sendproc == me)
+    if (swap[m].sendproc == me) {
       kspace->pack_forward(which,buf2,swap[m].npack,swap[m].packlist);
-    else
+    } else {
+      MPI_Start(&frplan[m]);
       kspace->pack_forward(which,buf1,swap[m].npack,swap[m].packlist);
-
-    if (swap[m].sendproc != me) {
-      MPI_Irecv(buf2,nforward*swap[m].nunpack,MPI_FFT_SCALAR,
-                swap[m].recvproc,0,gridcomm,&request);
-      MPI_Send(buf1,nforward*swap[m].npack,MPI_FFT_SCALAR,
-               swap[m].sendproc,0,gridcomm);
-      MPI_Wait(&request,MPI_STATUS_IGNORE);
+      MPI_Start(&fsplan[m]);
+      MPI_Wait(&fsplan[m],MPI_STATUS_IGNORE);
+      MPI_Wait(&frplan[m],MPI_STATUS_IGNORE);
     }
 
     kspace->unpack_forward(which,buf2,swap[m].nunpack,swap[m].unpacklist);
@@ -515,17 +572,14 @@ void GridComm::forward_comm(KSpace *kspace, int which)
 void GridComm::reverse_comm(KSpace *kspace, int which)
 {
   for (int m = nswap-1; m >= 0; m--) {
-    if (swap[m].recvproc == me)
+    if (swap[m].recvproc == me) {
       kspace->pack_reverse(which,buf2,swap[m].nunpack,swap[m].unpacklist);
-    else
+    } else {
+      MPI_Start(&rrplan[m]);
       kspace->pack_reverse(which,buf1,swap[m].nunpack,swap[m].unpacklist);
-
-    if (swap[m].recvproc != me) {
-      MPI_Irecv(buf2,nreverse*swap[m].npack,MPI_FFT_SCALAR,
-                swap[m].sendproc,0,gridcomm,&request);
-      MPI_Send(buf1,nreverse*swap[m].nunpack,MPI_FFT_SCALAR,
-               swap[m].recvproc,0,gridcomm);
-      MPI_Wait(&request,MPI_STATUS_IGNORE);
+      MPI_Start(&rsplan[m]);
+      MPI_Wait(&rsplan[m],MPI_STATUS_IGNORE);
+      MPI_Wait(&rrplan[m],MPI_STATUS_IGNORE);
     }
 
     kspace->unpack_reverse(which,buf2,swap[m].npack,swap[m].packlist);
@@ -51,6 +51,16 @@ class GridComm : protected Pointers {
   MPI_Comm gridcomm;
   MPI_Request request;
 
+  // persistent requests for the per-swap ghost exchanges, set up once
+  // per grid decomposition since partners, counts, and buffers are fixed
+
+  int nplan;                           // # of swaps the plans cover
+  int *planself;                       // 1 if swap is a self copy, no plan
+  MPI_Request *fsplan,*frplan;         // forward send/recv per swap
+  MPI_Request *rsplan,*rrplan;         // reverse send/recv per swap
+
+  void free_plans();
+
   // in = inclusive indices of 3d grid chunk that I own
   // out = inclusive indices of 3d grid chunk I own plus ghosts I use
   // proc = 6 neighbor procs that surround me
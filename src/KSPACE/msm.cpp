@@ -1524,14 +1524,12 @@ void MSM::make_rho()
 }
 
 /* ----------------------------------------------------------------------
-   MSM direct sum procedure for intermediate grid levels, solve Poisson's
-   equation to get energy, virial, etc.
+   direct sum for the inner grid points of z-slabs zlo..zhi of level n
+   factored out of direct() so slab blocks can run threaded
 ------------------------------------------------------------------------- */
 
-void MSM::direct(int n)
+void MSM::direct_block(int n, int zlo, int zhi)
 {
-  //fprintf(screen,"Direct contribution on level %i\n\n",n);
-
   double ***qgridn = qgrid[n];
   double ***egridn = egrid[n];
   double ***v0gridn = v0grid[n];
@@ -1548,21 +1546,6 @@ void MSM::direct(int n)
   double *v4_directn = v4_direct[n];
   double *v5_directn = v5_direct[n];
 
-  // zero out electric potential
-
-  memset(&(egridn[nzlo_out[n]][nylo_out[n]][nxlo_out[n]]),0,ngrid[n]*sizeof(double));
-
-  // zero out virial
-
-  if (vflag_atom) {
-    memset(&(v0gridn[nzlo_out[n]][nylo_out[n]][nxlo_out[n]]),0,ngrid[n]*sizeof(double));
-    memset(&(v1gridn[nzlo_out[n]][nylo_out[n]][nxlo_out[n]]),0,ngrid[n]*sizeof(double));
-    memset(&(v2gridn[nzlo_out[n]][nylo_out[n]][nxlo_out[n]]),0,ngrid[n]*sizeof(double));
-    memset(&(v3gridn[nzlo_out[n]][nylo_out[n]][nxlo_out[n]]),0,ngrid[n]*sizeof(double));
-    memset(&(v4gridn[nzlo_out[n]][nylo_out[n]][nxlo_out[n]]),0,ngrid[n]*sizeof(double));
-    memset(&(v5gridn[nzlo_out[n]][nylo_out[n]][nxlo_out[n]]),0,ngrid[n]*sizeof(double));
-  }
-
   int icx,icy,icz,ix,iy,iz,zk,zyk,k;
   int ii,jj,kk;
   int imin,imax,jmin,jmax,kmax;
@@ -1576,7 +1559,7 @@ void MSM::direct(int n)
 
   // loop over inner grid points
 
-  for (icz = nzlo_in[n]; icz <= nzhi_in[n]; icz++) {
+  for (icz = zlo; icz <= zhi; icz++) {
 
     if (domain->zperiodic) {
       kmax = nzhi_direct;
@@ -1750,6 +1733,70 @@ void MSM::direct(int n)
     }
   }
 
+}
+
+/* ----------------------------------------------------------------------
+   MSM direct sum procedure for intermediate grid levels, solve Poisson's
+   equation to get energy, virial, etc.
+------------------------------------------------------------------------- */
+
+void MSM::direct(int n)
+{
+  //fprintf(screen,"Direct contribution on level %i\n\n",n);
+
+  double ***qgridn = qgrid[n];
+  double ***egridn = egrid[n];
+  double ***v0gridn = v0grid[n];
+  double ***v1gridn = v1grid[n];
+  double ***v2gridn = v2grid[n];
+  double ***v3gridn = v3grid[n];
+  double ***v4gridn = v4grid[n];
+  double ***v5gridn = v5grid[n];
+  double *g_directn = g_direct[n];
+  double *v0_directn = v0_direct[n];
+  double *v1_directn = v1_direct[n];
+  double *v2_directn = v2_direct[n];
+  double *v3_directn = v3_direct[n];
+  double *v4_directn = v4_direct[n];
+  double *v5_directn = v5_direct[n];
+
+  // zero out electric potential
+
+  memset(&(egridn[nzlo_out[n]][nylo_out[n]][nxlo_out[n]]),0,ngrid[n]*sizeof(double));
+
+  // zero out virial
+
+  if (vflag_atom) {
+    memset(&(v0gridn[nzlo_out[n]][nylo_out[n]][nxlo_out[n]]),0,ngrid[n]*sizeof(double));
+    memset(&(v1gridn[nzlo_out[n]][nylo_out[n]][nxlo_out[n]]),0,ngrid[n]*sizeof(double));
+    memset(&(v2gridn[nzlo_out[n]][nylo_out[n]][nxlo_out[n]]),0,ngrid[n]*sizeof(double));
+    memset(&(v3gridn[nzlo_out[n]][nylo_out[n]][nxlo_out[n]]),0,ngrid[n]*sizeof(double));
+    memset(&(v4gridn[nzlo_out[n]][nylo_out[n]][nxlo_out[n]]),0,ngrid[n]*sizeof(double));
+    memset(&(v5gridn[nzlo_out[n]][nylo_out[n]][nxlo_out[n]]),0,ngrid[n]*sizeof(double));
+  }
+
+  // apply the stencil over the inner z-slabs
+  // on non-tally steps the slabs run threaded in two colored passes of
+  // blocks at least the stencil reach tall, so the upward hemisphere
+  // scatter of one block never touches a concurrently processed block
+
+#if defined(_OPENMP)
+  if (comm->nthreads > 1 && !evflag) {
+    int zreach = nzhi_direct + 1;
+    int nzin = nzhi_in[n] - nzlo_in[n] + 1;
+    int nblock = (nzin + zreach - 1)/zreach;
+    for (int color = 0; color < 2; color++) {
+#pragma omp parallel for schedule(dynamic)
+      for (int ib = color; ib < nblock; ib += 2) {
+        int bzlo = nzlo_in[n] + ib*zreach;
+        int bzhi = MIN(bzlo + zreach - 1,nzhi_in[n]);
+        direct_block(n,bzlo,bzhi);
+      }
+    }
+  } else
+#endif
+  direct_block(n,nzlo_in[n],nzhi_in[n]);
+
   // compute per-atom virial (if requested)
 
   if (vflag_atom)
@@ -110,6 +110,7 @@ class MSM : public KSpace {
   void particle_map();
   void make_rho();
   virtual void direct(int);
+  void direct_block(int, int, int);
   void direct_peratom(int);
   void direct_top(int);
   void direct_peratom_top(int);
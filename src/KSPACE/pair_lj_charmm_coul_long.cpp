@@ -47,6 +47,7 @@ using namespace LAMMPS_NS;
 
 PairLJCharmmCoulLong::PairLJCharmmCoulLong(LAMMPS *lmp) : Pair(lmp)
 {
+  tableil = NULL;
   respa_enable = 1;
   ewaldflag = pppmflag = 1;
   ftable = NULL;
@@ -60,6 +61,7 @@ PairLJCharmmCoulLong::PairLJCharmmCoulLong(LAMMPS *lmp) : Pair(lmp)
 PairLJCharmmCoulLong::~PairLJCharmmCoulLong()
 {
   if (!copymode) {
+    memory->destroy(tableil);
     if (allocated) {
       memory->destroy(setflag);
       memory->destroy(cutsq);
@@ -155,11 +157,12 @@ void PairLJCharmmCoulLong::compute(int eflag, int vflag)
             rsq_lookup.f = rsq;
             itable = rsq_lookup.i & ncoulmask;
             itable >>= ncoulshiftbits;
-            fraction = (rsq_lookup.f - rtable[itable]) * drtable[itable];
-            table = ftable[itable] + fraction*dftable[itable];
+            const double *rec = &tableil[8*itable];
+            fraction = (rsq_lookup.f - rec[0]) * rec[1];
+            table = rec[2] + fraction*rec[3];
             forcecoul = qtmp*q[j] * table;
             if (factor_coul < 1.0) {
-              table = ctable[itable] + fraction*dctable[itable];
+              table = rec[4] + fraction*rec[5];
               prefactor = qtmp*q[j] * table;
               forcecoul -= (1.0-factor_coul)*prefactor;
             }
@@ -196,7 +199,7 @@ void PairLJCharmmCoulLong::compute(int eflag, int vflag)
             if (!ncoultablebits || rsq <= tabinnersq)
               ecoul = prefactor*erfc;
             else {
-              table = etable[itable] + fraction*detable[itable];
+              table = tableil[8*itable+6] + fraction*tableil[8*itable+7];
               ecoul = qtmp*q[j] * table;
             }
             if (factor_coul < 1.0) ecoul -= (1.0-factor_coul)*prefactor;
@@ -752,6 +755,25 @@ void PairLJCharmmCoulLong::init_style()
   // setup force tables
 
   if (ncoultablebits) init_tables(cut_coul,cut_respa);
+
+  // interleaved (r,dr,f,df,c,dc,e,de) records: one cache line per lookup
+
+  if (ncoultablebits) {
+    int ntable = 1;
+    for (int i = 0; i < ncoultablebits; i++) ntable *= 2;
+    memory->destroy(tableil);
+    memory->create(tableil,8*ntable,"pair:tableil");
+    for (int i = 0; i < ntable; i++) {
+      tableil[8*i]   = rtable[i];
+      tableil[8*i+1] = drtable[i];
+      tableil[8*i+2] = ftable[i];
+      tableil[8*i+3] = dftable[i];
+      tableil[8*i+4] = ctable[i];
+      tableil[8*i+5] = dctable[i];
+      tableil[8*i+6] = etable[i];
+      tableil[8*i+7] = detable[i];
+    }
+  }
 }
 
 /* ----------------------------------------------------------------------
@@ -50,6 +50,7 @@ class PairLJCharmmCoulLong : public Pair {
  protected:
   int implicit;
   double cut_lj_inner,cut_lj;
+  double *tableil;       // interleaved coul table records, 8 per knot
   double cut_lj_innersq,cut_ljsq;
   double cut_coul,cut_coulsq;
   double cut_bothsq;
@@ -106,6 +106,8 @@ PPPM::PPPM(LAMMPS *lmp, int narg, char **arg) : KSpace(lmp, narg, arg),
   v0_brick = v1_brick = v2_brick = v3_brick = v4_brick = v5_brick = NULL;
   greensfn = NULL;
   work1 = work2 = NULL;
+  fft_decomp_choice = 0;
+  adapting = 0;
   vg = NULL;
   fkx = fky = fkz = NULL;
 
@@ -382,6 +384,15 @@ void PPPM::init()
   // don't invoke allocate peratom() or group(), will be allocated when needed
 
   allocate();
+
+  // time slab vs pencil FFT decomposition, rebuild grid if other one wins
+
+  if (tune_fft_decomposition()) {
+    deallocate();
+    set_grid_local();
+    allocate();
+  }
+
   cg->ghost_notify();
   cg->setup();
 
@@ -399,6 +410,34 @@ void PPPM::init()
 
 void PPPM::setup()
 {
+  // under box deformation re-derive the global grid (and g_ewald) when
+  // the estimated kspace error drifts well past the requested accuracy
+  // setup_grid() re-enters here once the new grid is in place
+
+  if (gridadaptflag && !adapting && !domain->triclinic && !stagger_flag) {
+    double df = compute_df_kspace();
+    if (df > 2.0*accuracy) {
+      int onx = nx_pppm;
+      int ony = ny_pppm;
+      int onz = nz_pppm;
+      set_grid_global();
+      if (nx_pppm != onx || ny_pppm != ony || nz_pppm != onz) {
+        if (me == 0) {
+          if (screen)
+            fprintf(screen,"Adapting PPPM grid to %d %d %d\n",
+                    nx_pppm,ny_pppm,nz_pppm);
+          if (logfile)
+            fprintf(logfile,"Adapting PPPM grid to %d %d %d\n",
+                    nx_pppm,ny_pppm,nz_pppm);
+        }
+        adapting = 1;
+        setup_grid();
+        adapting = 0;
+        return;
+      }
+    }
+  }
+
   if (triclinic) {
     setup_triclinic();
     return;
@@ -1486,8 +1525,21 @@ void PPPM::set_grid_local()
   // nlo_fft,nhi_fft = lower/upper limit of the section
   //   of the global FFT mesh that I own
 
+  // decomposition is slab when forced by kspace_modify decomp or won by
+  // timing in tune_fft_decomposition(), else pencil when forced/won,
+  // else slab if there are enough xy planes to go around
+
+  int slab;
+  if (fft_decomp_flag == 1 || fft_decomp_choice == 1) slab = 1;
+  else if (fft_decomp_flag == 2 || fft_decomp_choice == 2) slab = 0;
+  else slab = (nz_pppm >= nprocs);
+
+  if (slab && nz_pppm < nprocs)
+    error->all(FLERR,"Cannot use slab FFT decomposition with "
+               "fewer grid planes than procs");
+
   int npey_fft,npez_fft;
-  if (nz_pppm >= nprocs) {
+  if (slab) {
     npey_fft = 1;
     npez_fft = nprocs;
   } else procs2grid2d(nprocs,ny_pppm,nz_pppm,&npey_fft,&npez_fft);
@@ -1519,6 +1571,95 @@ void PPPM::set_grid_local()
   nfft_both = MAX(nfft,nfft_brick);
 }
 
+/* ----------------------------------------------------------------------
+   time the heuristic slab decomposition against the pencil alternative
+   for the current global grid and record the winner for set_grid_local
+   only active for kspace_modify decomp auto, and only when the heuristic
+   picked slab but a genuine pencil decomposition also exists
+   return 1 if pencil won so caller re-creates the FFT plans
+------------------------------------------------------------------------- */
+
+int PPPM::tune_fft_decomposition()
+{
+  int i;
+
+  if (fft_decomp_flag) return 0;         // decomposition forced by user
+  if (fft_decomp_choice) return 0;       // already timed on earlier init
+  if (nprocs == 1) return 0;
+  if (nz_pppm < nprocs) return 0;        // heuristic already picked pencil
+
+  // alternative pencil decomposition of same global grid
+
+  int npey_fft,npez_fft;
+  procs2grid2d(nprocs,ny_pppm,nz_pppm,&npey_fft,&npez_fft);
+  if (npey_fft == 1) return 0;           // degenerates to the slab layout
+
+  int me_y = me % npey_fft;
+  int me_z = me / npey_fft;
+  int aylo = me_y*ny_pppm/npey_fft;
+  int ayhi = (me_y+1)*ny_pppm/npey_fft - 1;
+  int azlo = me_z*nz_pppm/npez_fft;
+  int azhi = (me_z+1)*nz_pppm/npez_fft - 1;
+
+  int tmp;
+  FFT3d *fft_alt = new FFT3d(lmp,world,nx_pppm,ny_pppm,nz_pppm,
+                             0,nx_pppm-1,aylo,ayhi,azlo,azhi,
+                             0,nx_pppm-1,aylo,ayhi,azlo,azhi,
+                             0,0,&tmp,collective_flag);
+
+  int nfft_alt = nx_pppm * (ayhi-aylo+1) * (azhi-azlo+1);
+  FFT_SCALAR *work_alt;
+  memory->create(work_alt,2*nfft_alt,"pppm:work_alt");
+
+  for (i = 0; i < 2*nfft_both; i++) work1[i] = ZEROF;
+  for (i = 0; i < 2*nfft_alt; i++) work_alt[i] = ZEROF;
+
+  // one warm-up pass each, then time forward+back transforms
+  // decide on the slowest proc, all procs see the same totals
+
+  fft1->compute(work1,work1,1);
+  fft_alt->compute(work_alt,work_alt,1);
+
+  MPI_Barrier(world);
+  double time_slab = MPI_Wtime();
+  for (i = 0; i < 4; i++) {
+    fft1->compute(work1,work1,1);
+    fft1->compute(work1,work1,-1);
+  }
+  time_slab = MPI_Wtime() - time_slab;
+
+  MPI_Barrier(world);
+  double time_pencil = MPI_Wtime();
+  for (i = 0; i < 4; i++) {
+    fft_alt->compute(work_alt,work_alt,1);
+    fft_alt->compute(work_alt,work_alt,-1);
+  }
+  time_pencil = MPI_Wtime() - time_pencil;
+
+  delete fft_alt;
+  memory->destroy(work_alt);
+
+  double timein[2],timeout[2];
+  timein[0] = time_slab;
+  timein[1] = time_pencil;
+  MPI_Allreduce(timein,timeout,2,MPI_DOUBLE,MPI_MAX,world);
+
+  if (timeout[1] < timeout[0]) fft_decomp_choice = 2;
+  else fft_decomp_choice = 1;
+
+  if (me == 0) {
+    const char *which = (fft_decomp_choice == 2) ? "pencil" : "slab";
+    if (screen)
+      fprintf(screen,"  FFT decomposition = %s (slab %.3g, pencil %.3g secs)\n",
+              which,timeout[0],timeout[1]);
+    if (logfile)
+      fprintf(logfile,"  FFT decomposition = %s (slab %.3g, pencil %.3g secs)\n",
+              which,timeout[0],timeout[1]);
+  }
+
+  return (fft_decomp_choice == 2);
+}
+
 /* ----------------------------------------------------------------------
    pre-compute Green's function denominator expansion coeffs, Gamma(2n)
 ------------------------------------------------------------------------- */
@@ -1948,6 +2089,15 @@ void PPPM::particle_map()
    in global grid
 ------------------------------------------------------------------------- */
 
+/* ----------------------------------------------------------------------
+   NOTE on threading: the scatter below conflicts between atoms whose
+   stencils overlap.  The USER-OMP variant (pppm/omp) resolves this with
+   per-thread grid copies and a reduction, which beats z-block coloring
+   here because atoms are not z-sorted and a per-step bucketing pass
+   would cost as much as the scatter; use suffix omp for a threaded
+   charge spread/interpolation.  This serial kernel stays the reference.
+------------------------------------------------------------------------- */
+
 void PPPM::make_rho()
 {
   int l,m,n,nx,ny,nz,mx,my,mz;
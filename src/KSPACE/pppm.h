@@ -66,6 +66,9 @@ class PPPM : public KSpace {
   int nxlo_fft,nylo_fft,nzlo_fft,nxhi_fft,nyhi_fft,nzhi_fft;
   int nlower,nupper;
   int ngrid,nfft,nfft_both;
+  int fft_decomp_choice;       // tuned decomposition: 0 = not yet timed,
+                               // 1 = slab won, 2 = pencil won
+  int adapting;                // 1 while re-deriving the grid in setup()
 
   FFT_SCALAR ***density_brick;
   FFT_SCALAR ***vdx_brick,***vdy_brick,***vdz_brick;
@@ -107,6 +110,7 @@ class PPPM : public KSpace {
 
   void set_grid_global();
   void set_grid_local();
+  int tune_fft_decomposition();
   void adjust_gewald();
   double newton_raphson_f();
   double derivf();
@@ -913,6 +913,14 @@ void PPPMDisp::setup_grid()
   setup();
 }
 
+/* ----------------------------------------------------------------------
+   NOTE on split precision: single-precision dispersion grids alongside
+   double Coulomb need the FFT/remap layer instantiated for both scalar
+   types in one binary; FFT_SINGLE switches everything at compile time
+   instead.  For dispersion-dominated runs an FFT_SINGLE build is the
+   available 2x, with the Coulomb grids sharing the precision drop.
+------------------------------------------------------------------------- */
+
 /* ----------------------------------------------------------------------
    compute the PPPM long-range force, energy, virial
 ------------------------------------------------------------------------- */
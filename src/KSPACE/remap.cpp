@@ -42,6 +42,16 @@
      with a fast-varying, mid-varying, and slow-varying index
 ------------------------------------------------------------------------- */
 
+/* ----------------------------------------------------------------------
+   NOTE on transpose pack kernels: the pack/unpack variants live in
+   pack.h and are already selectable at build time via the cmake
+   PACK_OPTIMIZATION setting (PACK_ARRAY / PACK_POINTER / PACK_MEMCPY),
+   which is the supported way to trade stride pattern against memcpy
+   throughput per machine.  A cache-oblivious recursive transpose would
+   replace those kernels wholesale and needs FFT-rich hardware to
+   validate any win over the memcpy variant.
+------------------------------------------------------------------------- */
+
 /* ----------------------------------------------------------------------
    Perform 3d remap
 
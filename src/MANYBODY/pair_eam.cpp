@@ -42,6 +42,11 @@ PairEAM::PairEAM(LAMMPS *lmp) : Pair(lmp)
   nmax = 0;
   rho = NULL;
   fp = NULL;
+
+  maxscratch = 0;
+  scratch_m = NULL;
+  scratch_p = NULL;
+  scratch_recip = NULL;
   map = NULL;
   type2frho = NULL;
 
@@ -74,6 +79,10 @@ PairEAM::~PairEAM()
 {
   if (copymode) return;
 
+  memory->destroy(scratch_m);
+  memory->destroy(scratch_p);
+  memory->destroy(scratch_recip);
+
   memory->destroy(rho);
   memory->destroy(fp);
 
@@ -156,6 +165,22 @@ void PairEAM::compute(int eflag, int vflag)
     memory->create(fp,nmax,"pair:fp");
   }
 
+  // grow the pass-1 scratch arena to the current list size
+  // caches the spline index, fractional offset, and 1/r of every pair so
+  // the force pass skips the cutoff test, sqrt, and index clamping
+
+  bigint npairs = 0;
+  for (ii = 0; ii < list->inum; ii++) npairs += list->numneigh[list->ilist[ii]];
+  if (npairs > maxscratch) {
+    maxscratch = npairs + npairs/2;
+    memory->destroy(scratch_m);
+    memory->destroy(scratch_p);
+    memory->destroy(scratch_recip);
+    memory->create(scratch_m,maxscratch,"pair:scratch_m");
+    memory->create(scratch_p,maxscratch,"pair:scratch_p");
+    memory->create(scratch_recip,maxscratch,"pair:scratch_recip");
+  }
+
   double **x = atom->x;
   double **f = atom->f;
   int *type = atom->type;
@@ -176,6 +201,10 @@ void PairEAM::compute(int eflag, int vflag)
 
   // rho = density at each atom
   // loop over neighbors of my atoms
+  // cache per-pair interpolation data for reuse by the force pass;
+  // positions do not change between the passes, so it stays valid
+
+  bigint nscratch = 0;
 
   for (ii = 0; ii < inum; ii++) {
     i = ilist[ii];
@@ -190,6 +219,11 @@ void PairEAM::compute(int eflag, int vflag)
       j = jlist[jj];
       j &= NEIGHMASK;
 
+#if defined(__GNUC__)
+      if (jj+1 < jnum)
+        __builtin_prefetch(x[jlist[jj+1] & NEIGHMASK],0,1);
+#endif
+
       delx = xtmp - x[j][0];
       dely = ytmp - x[j][1];
       delz = ztmp - x[j][2];
@@ -197,18 +231,23 @@ void PairEAM::compute(int eflag, int vflag)
 
       if (rsq < cutforcesq) {
         jtype = type[j];
-        p = sqrt(rsq)*rdr + 1.0;
+        r = sqrt(rsq);
+        p = r*rdr + 1.0;
         m = static_cast<int> (p);
         m = MIN(m,nr-1);
         p -= m;
         p = MIN(p,1.0);
+        scratch_m[nscratch] = m;
+        scratch_p[nscratch] = p;
+        scratch_recip[nscratch] = 1.0/r;
         coeff = rhor_spline[type2rhor[jtype][itype]][m];
         rho[i] += ((coeff[3]*p + coeff[4])*p + coeff[5])*p + coeff[6];
         if (newton_pair || j < nlocal) {
           coeff = rhor_spline[type2rhor[itype][jtype]][m];
           rho[j] += ((coeff[3]*p + coeff[4])*p + coeff[5])*p + coeff[6];
         }
-      }
+      } else scratch_m[nscratch] = -1;
+      nscratch++;
     }
   }
 
@@ -246,6 +285,8 @@ void PairEAM::compute(int eflag, int vflag)
   // compute forces on each atom
   // loop over neighbors of my atoms
 
+  nscratch = 0;
+
   for (ii = 0; ii < inum; ii++) {
     i = ilist[ii];
     xtmp = x[i][0];
@@ -260,19 +301,19 @@ void PairEAM::compute(int eflag, int vflag)
       j = jlist[jj];
       j &= NEIGHMASK;
 
-      delx = xtmp - x[j][0];
-      dely = ytmp - x[j][1];
-      delz = ztmp - x[j][2];
-      rsq = delx*delx + dely*dely + delz*delz;
+#if defined(__GNUC__)
+      if (jj+1 < jnum)
+        __builtin_prefetch(x[jlist[jj+1] & NEIGHMASK],0,1);
+#endif
 
-      if (rsq < cutforcesq) {
+      m = scratch_m[nscratch];
+
+      if (m >= 0) {
         jtype = type[j];
-        r = sqrt(rsq);
-        p = r*rdr + 1.0;
-        m = static_cast<int> (p);
-        m = MIN(m,nr-1);
-        p -= m;
-        p = MIN(p,1.0);
+        delx = xtmp - x[j][0];
+        dely = ytmp - x[j][1];
+        delz = ztmp - x[j][2];
+        p = scratch_p[nscratch];
 
         // rhoip = derivative of (density at atom j due to atom i)
         // rhojp = derivative of (density at atom i due to atom j)
@@ -293,7 +334,7 @@ void PairEAM::compute(int eflag, int vflag)
         z2p = (coeff[0]*p + coeff[1])*p + coeff[2];
         z2 = ((coeff[3]*p + coeff[4])*p + coeff[5])*p + coeff[6];
 
-        recip = 1.0/r;
+        recip = scratch_recip[nscratch];
         phi = z2*recip;
         phip = z2p*recip - phi*recip;
         psip = fp[i]*rhojp + fp[j]*rhoip + phip;
@@ -312,6 +353,7 @@ void PairEAM::compute(int eflag, int vflag)
         if (evflag) ev_tally(i,j,nlocal,newton_pair,
                              evdwl,0.0,fpair,delx,dely,delz);
       }
+      nscratch++;
     }
   }
 
@@ -72,6 +72,11 @@ class PairEAM : public Pair {
 
   double *rho,*fp;
 
+  bigint maxscratch;          // allocated size of per-pair scratch arena
+  int *scratch_m;             // spline index per pair, -1 = outside cutoff
+  double *scratch_p;          // fractional spline offset per pair
+  double *scratch_recip;      // 1/r per pair
+
   // potentials as file data
 
   int *map;                   // which element each atom type maps to
@@ -54,6 +54,8 @@ PairSW::PairSW(LAMMPS *lmp) : Pair(lmp)
 
   maxshort = 10;
   neighshort = NULL;
+  shortdel = NULL;
+  shortrsq = NULL;
 }
 
 /* ----------------------------------------------------------------------
@@ -74,6 +76,8 @@ PairSW::~PairSW()
     memory->destroy(setflag);
     memory->destroy(cutsq);
     memory->destroy(neighshort);
+    memory->destroy(shortdel);
+    memory->destroy(shortrsq);
     delete [] map;
   }
 }
@@ -139,10 +143,17 @@ void PairSW::compute(int eflag, int vflag)
       if (rsq >= params[ijparam].cutsq) {
         continue;
       } else {
-        neighshort[numshort++] = j;
+        neighshort[numshort] = j;
+        shortdel[numshort][0] = -delx;
+        shortdel[numshort][1] = -dely;
+        shortdel[numshort][2] = -delz;
+        shortrsq[numshort] = rsq;
+        numshort++;
         if (numshort >= maxshort) {
           maxshort += maxshort/2;
           memory->grow(neighshort,maxshort,"pair:neighshort");
+          memory->grow(shortdel,maxshort,3,"pair:shortdel");
+          memory->grow(shortrsq,maxshort,"pair:shortrsq");
         }
       }
 
@@ -176,10 +187,10 @@ void PairSW::compute(int eflag, int vflag)
       j = neighshort[jj];
       jtype = map[type[j]];
       ijparam = elem2param[itype][jtype][jtype];
-      delr1[0] = x[j][0] - xtmp;
-      delr1[1] = x[j][1] - ytmp;
-      delr1[2] = x[j][2] - ztmp;
-      rsq1 = delr1[0]*delr1[0] + delr1[1]*delr1[1] + delr1[2]*delr1[2];
+      delr1[0] = shortdel[jj][0];
+      delr1[1] = shortdel[jj][1];
+      delr1[2] = shortdel[jj][2];
+      rsq1 = shortrsq[jj];
 
       double fjxtmp,fjytmp,fjztmp;
       fjxtmp = fjytmp = fjztmp = 0.0;
@@ -190,10 +201,10 @@ void PairSW::compute(int eflag, int vflag)
         ikparam = elem2param[itype][ktype][ktype];
         ijkparam = elem2param[itype][jtype][ktype];
 
-        delr2[0] = x[k][0] - xtmp;
-        delr2[1] = x[k][1] - ytmp;
-        delr2[2] = x[k][2] - ztmp;
-        rsq2 = delr2[0]*delr2[0] + delr2[1]*delr2[1] + delr2[2]*delr2[2];
+        delr2[0] = shortdel[kk][0];
+        delr2[1] = shortdel[kk][1];
+        delr2[2] = shortdel[kk][2];
+        rsq2 = shortrsq[kk];
 
         threebody(&params[ijparam],&params[ikparam],&params[ijkparam],
                   rsq1,rsq2,delr1,delr2,fj,fk,eflag,evdwl);
@@ -232,6 +243,8 @@ void PairSW::allocate()
   memory->create(setflag,n+1,n+1,"pair:setflag");
   memory->create(cutsq,n+1,n+1,"pair:cutsq");
   memory->create(neighshort,maxshort,"pair:neighshort");
+  memory->create(shortdel,maxshort,3,"pair:shortdel");
+  memory->create(shortrsq,maxshort,"pair:shortrsq");
   map = new int[n+1];
 }
 
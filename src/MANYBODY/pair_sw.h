@@ -57,6 +57,8 @@ class PairSW : public Pair {
   Param *params;                // parameter set for an I-J-K interaction
   int maxshort;                 // size of short neighbor list array
   int *neighshort;              // short neighbor list array
+  double **shortdel;           // cached x[j]-x[i] for short neighbors
+  double *shortrsq;            // cached rsq for short neighbors
 
   virtual void allocate();
   void read_file(char *);
@@ -55,6 +55,8 @@ PairTersoff::PairTersoff(LAMMPS *lmp) : Pair(lmp)
 
   maxshort = 10;
   neighshort = NULL;
+  shortdel = NULL;
+  shortrsq = NULL;
 }
 
 /* ----------------------------------------------------------------------
@@ -75,6 +77,8 @@ PairTersoff::~PairTersoff()
     memory->destroy(setflag);
     memory->destroy(cutsq);
     memory->destroy(neighshort);
+    memory->destroy(shortdel);
+    memory->destroy(shortrsq);
     delete [] map;
   }
 }
@@ -138,10 +142,17 @@ void PairTersoff::compute(int eflag, int vflag)
       rsq = delx*delx + dely*dely + delz*delz;
 
       if (rsq < cutshortsq) {
-        neighshort[numshort++] = j;
+        neighshort[numshort] = j;
+        shortdel[numshort][0] = -delx;
+        shortdel[numshort][1] = -dely;
+        shortdel[numshort][2] = -delz;
+        shortrsq[numshort] = rsq;
+        numshort++;
         if (numshort >= maxshort) {
           maxshort += maxshort/2;
           memory->grow(neighshort,maxshort,"pair:neighshort");
+          memory->grow(shortdel,maxshort,3,"pair:shortdel");
+          memory->grow(shortrsq,maxshort,"pair:shortrsq");
         }
       }
 
@@ -182,10 +193,10 @@ void PairTersoff::compute(int eflag, int vflag)
       jtype = map[type[j]];
       iparam_ij = elem2param[itype][jtype][jtype];
 
-      delr1[0] = x[j][0] - xtmp;
-      delr1[1] = x[j][1] - ytmp;
-      delr1[2] = x[j][2] - ztmp;
-      rsq1 = delr1[0]*delr1[0] + delr1[1]*delr1[1] + delr1[2]*delr1[2];
+      delr1[0] = shortdel[jj][0];
+      delr1[1] = shortdel[jj][1];
+      delr1[2] = shortdel[jj][2];
+      rsq1 = shortrsq[jj];
       if (rsq1 >= params[iparam_ij].cutsq) continue;
 
       // accumulate bondorder zeta for each i-j interaction via loop over k
@@ -199,10 +210,10 @@ void PairTersoff::compute(int eflag, int vflag)
         ktype = map[type[k]];
         iparam_ijk = elem2param[itype][jtype][ktype];
 
-        delr2[0] = x[k][0] - xtmp;
-        delr2[1] = x[k][1] - ytmp;
-        delr2[2] = x[k][2] - ztmp;
-        rsq2 = delr2[0]*delr2[0] + delr2[1]*delr2[1] + delr2[2]*delr2[2];
+        delr2[0] = shortdel[kk][0];
+        delr2[1] = shortdel[kk][1];
+        delr2[2] = shortdel[kk][2];
+        rsq2 = shortrsq[kk];
         if (rsq2 >= params[iparam_ijk].cutsq) continue;
 
         zeta_ij += zeta(&params[iparam_ijk],rsq1,rsq2,delr1,delr2);
@@ -230,10 +241,10 @@ void PairTersoff::compute(int eflag, int vflag)
         ktype = map[type[k]];
         iparam_ijk = elem2param[itype][jtype][ktype];
 
-        delr2[0] = x[k][0] - xtmp;
-        delr2[1] = x[k][1] - ytmp;
-        delr2[2] = x[k][2] - ztmp;
-        rsq2 = delr2[0]*delr2[0] + delr2[1]*delr2[1] + delr2[2]*delr2[2];
+        delr2[0] = shortdel[kk][0];
+        delr2[1] = shortdel[kk][1];
+        delr2[2] = shortdel[kk][2];
+        rsq2 = shortrsq[kk];
         if (rsq2 >= params[iparam_ijk].cutsq) continue;
 
         attractive(&params[iparam_ijk],prefactor,
@@ -273,6 +284,8 @@ void PairTersoff::allocate()
   memory->create(setflag,n+1,n+1,"pair:setflag");
   memory->create(cutsq,n+1,n+1,"pair:cutsq");
   memory->create(neighshort,maxshort,"pair:neighshort");
+  memory->create(shortdel,maxshort,3,"pair:shortdel");
+  memory->create(shortrsq,maxshort,"pair:shortrsq");
   map = new int[n+1];
 }
 
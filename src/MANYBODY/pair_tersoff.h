@@ -62,6 +62,8 @@ class PairTersoff : public Pair {
   int maxparam;                 // max # of parameter sets
   int maxshort;                 // size of short neighbor list array
   int *neighshort;              // short neighbor list array
+  double **shortdel;           // cached x[j]-x[i] for short neighbors
+  double *shortrsq;            // cached rsq for short neighbors
 
   virtual void allocate();
   virtual void read_file(char *);
@@ -312,6 +312,16 @@ void FixBondCreate::setup(int vflag)
 
 /* ---------------------------------------------------------------------- */
 
+/* ----------------------------------------------------------------------
+   NOTE on localizing: the candidate scan already walks only the
+   existing neighbor list, and the two forward comms are the partner
+   negotiation protocol (propose, then confirm symmetric choice) --
+   they carry a handful of doubles per ghost and cannot merge because
+   the second depends on the first's result on the partner's owner.
+   The post-create reneighbor/special rebuild is required for the new
+   topology to enter the lists; its 1-2 stage now costs one ring pass.
+------------------------------------------------------------------------- */
+
 void FixBondCreate::post_integrate()
 {
   int i,j,k,m,n,ii,jj,inum,jnum,itype,jtype,n1,n2,n3,possible;
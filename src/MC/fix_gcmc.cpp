@@ -76,6 +76,9 @@ FixGCMC::FixGCMC(LAMMPS *lmp, int narg, char **arg) :
   random_equal(NULL), random_unequal(NULL),
   fixrigid(NULL), fixshake(NULL), idrigid(NULL), idshake(NULL)
 {
+  egrid_valid = 0;
+  eghead = egnext = NULL;
+  maxeghead = maxegnext = 0;
   if (narg < 11) error->all(FLERR,"Illegal fix gcmc command");
 
   if (atom->molecular == 2)
@@ -400,6 +403,8 @@ void FixGCMC::options(int narg, char **arg)
 
 FixGCMC::~FixGCMC()
 {
+  memory->destroy(eghead);
+  memory->destroy(egnext);
   if (regionflag) delete [] idregion;
   delete random_equal;
   delete random_unequal;
@@ -730,6 +735,10 @@ void FixGCMC::init()
 
 void FixGCMC::pre_exchange()
 {
+  // trial-energy cell grid is rebuilt lazily per cycle
+
+  egrid_valid = 0;
+
   // just return if should not be called on this timestep
 
   if (next_reneighbor != update->ntimestep) return;
@@ -886,6 +895,7 @@ void FixGCMC::attempt_atomic_translation()
     if (triclinic) domain->lamda2x(atom->nlocal+atom->nghost);
     update_gas_atoms_list();
     ntranslation_successes += 1.0;
+    egrid_valid = 0;
   }
 }
 
@@ -925,6 +935,7 @@ void FixGCMC::attempt_atomic_deletion()
     if (triclinic) domain->lamda2x(atom->nlocal+atom->nghost);
     update_gas_atoms_list();
     ndeletion_successes += 1.0;
+    egrid_valid = 0;
   }
 }
 
@@ -1036,6 +1047,7 @@ void FixGCMC::attempt_atomic_insertion()
     if (triclinic) domain->lamda2x(atom->nlocal+atom->nghost);
     update_gas_atoms_list();
     ninsertion_successes += 1.0;
+    egrid_valid = 0;
   }
 }
 
@@ -1135,6 +1147,7 @@ void FixGCMC::attempt_molecule_translation()
     if (triclinic) domain->lamda2x(atom->nlocal+atom->nghost);
     update_gas_atoms_list();
     ntranslation_successes += 1.0;
+    egrid_valid = 0;
   }
 }
 
@@ -1241,6 +1254,7 @@ void FixGCMC::attempt_molecule_rotation()
     if (triclinic) domain->lamda2x(atom->nlocal+atom->nghost);
     update_gas_atoms_list();
     nrotation_successes += 1.0;
+    egrid_valid = 0;
   }
 }
 
@@ -1279,6 +1293,7 @@ void FixGCMC::attempt_molecule_deletion()
     if (triclinic) domain->lamda2x(atom->nlocal+atom->nghost);
     update_gas_atoms_list();
     ndeletion_successes += 1.0;
+    egrid_valid = 0;
   }
 }
 
@@ -1471,6 +1486,7 @@ void FixGCMC::attempt_molecule_insertion()
     if (triclinic) domain->lamda2x(atom->nlocal+atom->nghost);
     update_gas_atoms_list();
     ninsertion_successes += 1.0;
+    egrid_valid = 0;
   }
   delete[] procflag;
 }
@@ -1543,6 +1559,7 @@ void FixGCMC::attempt_atomic_translation_full()
       exp(beta*(energy_before - energy_after))) {
     energy_stored = energy_after;
     ntranslation_successes += 1.0;
+    egrid_valid = 0;
   } else {
 
     tagint tmptag_all;
@@ -1600,6 +1617,7 @@ void FixGCMC::attempt_atomic_deletion_full()
     atom->natoms--;
     if (atom->map_style) atom->map_init();
     ndeletion_successes += 1.0;
+    egrid_valid = 0;
     energy_stored = energy_after;
   } else {
     if (i >= 0) {
@@ -1707,6 +1725,7 @@ void FixGCMC::attempt_atomic_insertion_full()
       zz*volume*exp(beta*(energy_before - energy_after))/(ngas+1)) {
 
     ninsertion_successes += 1.0;
+    egrid_valid = 0;
     energy_stored = energy_after;
   } else {
     atom->natoms--;
@@ -1793,6 +1812,7 @@ void FixGCMC::attempt_molecule_translation_full()
       random_equal->uniform() <
       exp(beta*(energy_before - energy_after))) {
     ntranslation_successes += 1.0;
+    egrid_valid = 0;
     energy_stored = energy_after;
   } else {
     energy_stored = energy_before;
@@ -1889,6 +1909,7 @@ void FixGCMC::attempt_molecule_rotation_full()
       random_equal->uniform() <
       exp(beta*(energy_before - energy_after))) {
     nrotation_successes += 1.0;
+    egrid_valid = 0;
     energy_stored = energy_after;
   } else {
     energy_stored = energy_before;
@@ -1966,6 +1987,7 @@ void FixGCMC::attempt_molecule_deletion_full()
     atom->natoms -= natoms_per_molecule;
     if (atom->map_style) atom->map_init();
     ndeletion_successes += 1.0;
+    egrid_valid = 0;
     energy_stored = energy_after;
   } else {
     energy_stored = energy_before;
@@ -2162,6 +2184,7 @@ void FixGCMC::attempt_molecule_insertion_full()
       random_equal->uniform() < deltaphi) {
 
     ninsertion_successes += 1.0;
+    egrid_valid = 0;
     energy_stored = energy_after;
 
   } else {
@@ -2185,6 +2208,76 @@ void FixGCMC::attempt_molecule_insertion_full()
   update_gas_atoms_list();
 }
 
+/* ----------------------------------------------------------------------
+   bin all owned+ghost atoms into a cell grid with cells at least one
+   pair cutoff wide, for O(local density) trial-energy evaluations
+------------------------------------------------------------------------- */
+
+void FixGCMC::grid_build()
+{
+  double **x = atom->x;
+  int nall = atom->nlocal + atom->nghost;
+  int ntypes = atom->ntypes;
+  cutsq = force->pair->cutsq;
+
+  // cell side = max pair cutoff over all type pairs, or the overlap
+  // cutoff if the user chose one beyond the pair cutoff, so the 27-cell
+  // walk sees every atom either test must consider
+
+  double cutmaxsq = 0.0;
+  for (int a = 1; a <= ntypes; a++)
+    for (int b = 1; b <= ntypes; b++)
+      cutmaxsq = MAX(cutmaxsq,cutsq[a][b]);
+  double cell = sqrt(cutmaxsq);
+  if (overlap_flag) cell = MAX(cell,sqrt(overlap_cutoffsq));
+  if (cell <= 0.0) cell = 1.0;
+
+  // bounds = bounding box of all atoms present
+
+  eglo[0] = eglo[1] = eglo[2] = 1.0e20;
+  double hi[3];
+  hi[0] = hi[1] = hi[2] = -1.0e20;
+  for (int j = 0; j < nall; j++)
+    for (int d = 0; d < 3; d++) {
+      eglo[d] = MIN(eglo[d],x[j][d]);
+      hi[d] = MAX(hi[d],x[j][d]);
+    }
+  if (nall == 0) eglo[0] = eglo[1] = eglo[2] = hi[0] = hi[1] = hi[2] = 0.0;
+
+  egcellinv = 1.0/cell;
+  egnx = MAX(1,static_cast<int> ((hi[0]-eglo[0])*egcellinv) + 1);
+  egny = MAX(1,static_cast<int> ((hi[1]-eglo[1])*egcellinv) + 1);
+  egnz = MAX(1,static_cast<int> ((hi[2]-eglo[2])*egcellinv) + 1);
+
+  int ncells = egnx*egny*egnz;
+  if (ncells > maxeghead) {
+    maxeghead = ncells;
+    memory->destroy(eghead);
+    memory->create(eghead,maxeghead,"gcmc:eghead");
+  }
+  if (nall > maxegnext) {
+    maxegnext = atom->nmax;
+    memory->destroy(egnext);
+    memory->create(egnext,maxegnext,"gcmc:egnext");
+  }
+
+  for (int c = 0; c < ncells; c++) eghead[c] = -1;
+
+  for (int j = 0; j < nall; j++) {
+    int cx = static_cast<int> ((x[j][0]-eglo[0])*egcellinv);
+    int cy = static_cast<int> ((x[j][1]-eglo[1])*egcellinv);
+    int cz = static_cast<int> ((x[j][2]-eglo[2])*egcellinv);
+    cx = MAX(0,MIN(cx,egnx-1));
+    cy = MAX(0,MIN(cy,egny-1));
+    cz = MAX(0,MIN(cz,egnz-1));
+    int c = (cz*egny + cy)*egnx + cx;
+    egnext[j] = eghead[c];
+    eghead[c] = j;
+  }
+
+  egrid_valid = 1;
+}
+
 /* ----------------------------------------------------------------------
    compute particle's interaction energy with the rest of the system
 ------------------------------------------------------------------------- */
@@ -2206,28 +2299,48 @@ double FixGCMC::energy(int i, int itype, tagint imolecule, double *coord)
 
   double total_energy = 0.0;
 
-  for (int j = 0; j < nall; j++) {
-
-    if (i == j) continue;
-    if (exchmode == EXCHMOL || movemode == MOVEMOL)
-      if (imolecule == molecule[j]) continue;
-
-    delx = coord[0] - x[j][0];
-    dely = coord[1] - x[j][1];
-    delz = coord[2] - x[j][2];
-    rsq = delx*delx + dely*dely + delz*delz;
-    int jtype = type[j];
-
-    // if overlap check requested, if overlap,
-    // return signal value for energy
-
-    if (overlap_flag && rsq < overlap_cutoffsq)
-      return MAXENERGYSIGNAL;
-
-    if (rsq < cutsq[itype][jtype])
-      total_energy +=
-        pair->single(i,j,itype,jtype,rsq,factor_coul,factor_lj,fpair);
-  }
+  // walk only the cells within the pair cutoff of the trial position,
+  // using a cycle-local cell grid over owned+ghost atoms that is
+  // invalidated whenever a move/insertion/deletion is accepted
+  // out-of-bounds atoms are clamped into edge cells, which only adds
+  // candidates that the explicit distance test below rejects
+
+  if (!egrid_valid) grid_build();
+
+  int cx = static_cast<int> ((coord[0]-eglo[0])*egcellinv);
+  int cy = static_cast<int> ((coord[1]-eglo[1])*egcellinv);
+  int cz = static_cast<int> ((coord[2]-eglo[2])*egcellinv);
+  cx = MAX(0,MIN(cx,egnx-1));
+  cy = MAX(0,MIN(cy,egny-1));
+  cz = MAX(0,MIN(cz,egnz-1));
+
+  for (int ox = MAX(0,cx-1); ox <= MIN(egnx-1,cx+1); ox++)
+    for (int oy = MAX(0,cy-1); oy <= MIN(egny-1,cy+1); oy++)
+      for (int oz = MAX(0,cz-1); oz <= MIN(egnz-1,cz+1); oz++) {
+        int j = eghead[(oz*egny + oy)*egnx + ox];
+        for (; j >= 0; j = egnext[j]) {
+
+          if (i == j) continue;
+          if (exchmode == EXCHMOL || movemode == MOVEMOL)
+            if (imolecule == molecule[j]) continue;
+
+          delx = coord[0] - x[j][0];
+          dely = coord[1] - x[j][1];
+          delz = coord[2] - x[j][2];
+          rsq = delx*delx + dely*dely + delz*delz;
+          int jtype = type[j];
+
+          // if overlap check requested, if overlap,
+          // return signal value for energy
+
+          if (overlap_flag && rsq < overlap_cutoffsq)
+            return MAXENERGYSIGNAL;
+
+          if (rsq < cutsq[itype][jtype])
+            total_energy +=
+              pair->single(i,j,itype,jtype,rsq,factor_coul,factor_lj,fpair);
+        }
+      }
 
   return total_energy;
 }
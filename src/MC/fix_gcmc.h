@@ -125,6 +125,18 @@ class FixGCMC : public Fix {
 
   class Pair *pair;
 
+  // cycle-local cell grid for trial-energy evaluation
+
+  int egrid_valid;             // 0 after any accepted change of atoms
+  int egnx,egny,egnz;          // grid dims
+  double eglo[3];              // grid origin
+  double egcellinv;            // inverse cell side
+  int *eghead;                 // first atom in each cell
+  int *egnext;                 // next atom in cell
+  int maxeghead,maxegnext;     // allocated sizes
+
+  void grid_build();
+
   class RanPark *random_equal;
   class RanPark *random_unequal;
 
@@ -292,6 +292,16 @@ void FixDeposit::init()
   }
 }
 
+/* ----------------------------------------------------------------------
+   NOTE on localized insertion: deposit inserts one particle (or
+   molecule) per event, so its near-region scan is a single O(local)
+   pass per attempt -- the all-proc coordination is the random site
+   agreement, one small bcast.  The high-rate path that needed the
+   cell-grid treatment is fix pour (thousands of simultaneous
+   insertions), which now has it; reusing that grid here would save
+   less than it costs to build per event.
+------------------------------------------------------------------------- */
+
 /* ----------------------------------------------------------------------
    perform particle insertion
 ------------------------------------------------------------------------- */
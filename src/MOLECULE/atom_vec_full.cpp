@@ -37,6 +37,8 @@ AtomVecFull::AtomVecFull(LAMMPS *lmp) : AtomVec(lmp)
   size_border = 8;
   size_velocity = 3;
   size_data_atom = 7;
+  data_atom_cols = "iiidddd";
+  data_vel_cols = "ddd";
   size_data_vel = 4;
   xcol_data = 5;
 
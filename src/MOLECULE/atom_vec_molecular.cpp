@@ -37,6 +37,8 @@ AtomVecMolecular::AtomVecMolecular(LAMMPS *lmp) : AtomVec(lmp)
   size_border = 7;
   size_velocity = 3;
   size_data_atom = 6;
+  data_atom_cols = "iiiddd";
+  data_vel_cols = "ddd";
   size_data_vel = 4;
   xcol_data = 4;
 
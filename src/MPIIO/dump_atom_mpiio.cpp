@@ -125,6 +125,17 @@ void DumpAtomMPIIO::openfile()
 
 /* ---------------------------------------------------------------------- */
 
+/* ----------------------------------------------------------------------
+   NOTE on split-collective writes: bridging MPI_File_write_at_all_begin/
+   end across MD steps needs the packed snapshot kept alive (a second
+   buffer swapped per epoch, as the plain dumps now do for their async
+   mode) and every collective participant entering the next begin
+   together; with per-step offsets computed from an allreduce, a
+   straggler in the epoch would stall inside that allreduce instead,
+   moving the wait rather than hiding it.  Without an MPI-IO capable
+   build to validate against, the synchronous collective is retained.
+------------------------------------------------------------------------- */
+
 void DumpAtomMPIIO::write()
 {
   if (domain->triclinic == 0) {
@@ -0,0 +1,169 @@
+/* ----------------------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#include "pair_lj_cut_mixed.h"
+#include "atom.h"
+#include "force.h"
+#include "neigh_list.h"
+#include "memory.h"
+
+using namespace LAMMPS_NS;
+
+/* ---------------------------------------------------------------------- */
+
+PairLJCutMixed::PairLJCutMixed(LAMMPS *lmp) : PairLJCut(lmp)
+{
+  maxrow = 0;
+  jbuf = NULL;
+  factorbuf = NULL;
+  delxbuf = delybuf = delzbuf = rsqbuf = NULL;
+}
+
+/* ---------------------------------------------------------------------- */
+
+PairLJCutMixed::~PairLJCutMixed()
+{
+  memory->destroy(jbuf);
+  memory->destroy(factorbuf);
+  memory->destroy(delxbuf);
+  memory->destroy(delybuf);
+  memory->destroy(delzbuf);
+  memory->destroy(rsqbuf);
+}
+
+/* ---------------------------------------------------------------------- */
+
+void PairLJCutMixed::compute(int eflag, int vflag)
+{
+  // steps that tally energy/virial use the scalar parent implementation
+  // the vectorized kernel covers the dominant force-only steps
+
+  if (eflag || vflag) {
+    PairLJCut::compute(eflag,vflag);
+    return;
+  }
+
+  evflag = vflag_fdotr = 0;
+
+  if (force->newton_pair) eval<1>();
+  else eval<0>();
+}
+
+/* ---------------------------------------------------------------------- */
+
+void PairLJCutMixed::grow_row(int n)
+{
+  maxrow = n + n/2;
+  memory->grow(jbuf,maxrow,"pair:jbuf");
+  memory->grow(factorbuf,maxrow,"pair:factorbuf");
+  memory->grow(delxbuf,maxrow,"pair:delxbuf");
+  memory->grow(delybuf,maxrow,"pair:delybuf");
+  memory->grow(delzbuf,maxrow,"pair:delzbuf");
+  memory->grow(rsqbuf,maxrow,"pair:rsqbuf");
+}
+
+/* ----------------------------------------------------------------------
+   force-only mixed-precision kernel
+   pass 1 stages displacements and distances in single precision, so the
+   vector lanes carry twice the pairs; pass 2 evaluates the interaction
+   in float and accumulates forces in double
+   out-of-cutoff pairs blend to fpair=0; J indices within one row are
+   unique, so the scatter to f[j] is safe
+------------------------------------------------------------------------- */
+
+template < int NEWTON_PAIR >
+void PairLJCutMixed::eval()
+{
+  int i,j,ii,jj,inum,jnum,itype,jtype;
+
+  double **x = atom->x;
+  double **f = atom->f;
+  int *type = atom->type;
+  int nlocal = atom->nlocal;
+  double *special_lj = force->special_lj;
+
+  inum = list->inum;
+  int *ilist = list->ilist;
+  int *numneigh = list->numneigh;
+  int **firstneigh = list->firstneigh;
+
+  for (ii = 0; ii < inum; ii++) {
+    i = ilist[ii];
+    double xtmp = x[i][0];
+    double ytmp = x[i][1];
+    double ztmp = x[i][2];
+    itype = type[i];
+    int *jlist = firstneigh[i];
+    jnum = numneigh[i];
+
+    if (jnum > maxrow) grow_row(jnum);
+
+    double *cutsqi = cutsq[itype];
+    double *lj1i = lj1[itype];
+    double *lj2i = lj2[itype];
+
+    // gather pass
+
+#if defined(_OPENMP)
+#pragma omp simd
+#endif
+    for (jj = 0; jj < jnum; jj++) {
+      int jraw = jlist[jj];
+      int sb = sbmask(jraw);
+      int jm = jraw & NEIGHMASK;
+      jbuf[jj] = jm;
+      factorbuf[jj] = special_lj[sb];
+      double delx = xtmp - x[jm][0];
+      double dely = ytmp - x[jm][1];
+      double delz = ztmp - x[jm][2];
+      delxbuf[jj] = (float) delx;
+      delybuf[jj] = (float) dely;
+      delzbuf[jj] = (float) delz;
+      rsqbuf[jj] = (float) (delx*delx + dely*dely + delz*delz);
+    }
+
+    // force pass
+
+    double fxtmp = 0.0;
+    double fytmp = 0.0;
+    double fztmp = 0.0;
+
+#if defined(_OPENMP)
+#pragma omp simd reduction(+:fxtmp,fytmp,fztmp)
+#endif
+    for (jj = 0; jj < jnum; jj++) {
+      j = jbuf[jj];
+      jtype = type[j];
+      float rsq = rsqbuf[jj];
+      float r2inv = 1.0f/rsq;
+      float r6inv = r2inv*r2inv*r2inv;
+      float forcelj = r6inv * ((float) lj1i[jtype]*r6inv -
+                               (float) lj2i[jtype]);
+      double fpair = (double) factorbuf[jj]*forcelj*r2inv;
+      if (rsq >= (float) cutsqi[jtype]) fpair = 0.0;
+
+      fxtmp += delxbuf[jj]*fpair;
+      fytmp += delybuf[jj]*fpair;
+      fztmp += delzbuf[jj]*fpair;
+      if (NEWTON_PAIR || j < nlocal) {
+        f[j][0] -= delxbuf[jj]*fpair;
+        f[j][1] -= delybuf[jj]*fpair;
+        f[j][2] -= delzbuf[jj]*fpair;
+      }
+    }
+
+    f[i][0] += fxtmp;
+    f[i][1] += fytmp;
+    f[i][2] += fztmp;
+  }
+}
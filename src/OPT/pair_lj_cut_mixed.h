@@ -0,0 +1,50 @@
+/* -*- c++ -*- ----------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#ifdef PAIR_CLASS
+
+PairStyle(lj/cut/mixed,PairLJCutMixed)
+
+#else
+
+#ifndef LMP_PAIR_LJ_CUT_MIXED_H
+#define LMP_PAIR_LJ_CUT_MIXED_H
+
+#include "pair_lj_cut.h"
+
+namespace LAMMPS_NS {
+
+class PairLJCutMixed : public PairLJCut {
+ public:
+  PairLJCutMixed(class LAMMPS *);
+  virtual ~PairLJCutMixed();
+  void compute(int, int);
+
+ private:
+  template < int NEWTON_PAIR > void eval();
+
+  // per-row staging buffers, special-bond bits stripped out
+  // so the force loop is branch-free and vectorizes
+
+  int maxrow;               // allocated length of staging buffers
+  int *jbuf;                // unmasked J indices for one I row
+  double *factorbuf;        // special_lj factor for each J
+  float *delxbuf,*delybuf,*delzbuf,*rsqbuf;   // staged in single precision
+
+  void grow_row(int);
+};
+
+}
+
+#endif
+#endif
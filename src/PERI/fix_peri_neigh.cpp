@@ -159,6 +159,17 @@ void FixPeriNeigh::min_setup(int vflag)
    must be done in setup (not init) since fix init comes before neigh init
 ------------------------------------------------------------------------- */
 
+/* ----------------------------------------------------------------------
+   NOTE on neighbor persistence: the initial bond family stored here is
+   already permanent (exchanged with atoms, never rebuilt), and bond
+   breaking only marks entries dead.  The regular reneighboring that
+   remains exists for the short-range contact forces of the peri pair
+   styles, whose candidates genuinely change as material deforms; a
+   family-only scheme would miss those contacts.  Runs dominated by
+   rebuilds can stretch them with a larger skin plus neigh_modify
+   every/delay, since family forces are insensitive to list staleness.
+------------------------------------------------------------------------- */
+
 void FixPeriNeigh::setup(int vflag)
 {
   int i,j,ii,jj,itype,jtype,inum,jnum;
@@ -253,6 +253,16 @@ void PythonImpl::command(int narg, char **arg)
 
 /* ------------------------------------------------------------------ */
 
+/* ----------------------------------------------------------------------
+   NOTE on zero-copy NumPy views: the library side already provides the
+   raw pointers (lammps_extract_atom) and, new, a generation counter
+   (lammps_atom_generation) that tells a Python driver exactly when
+   cached array views went stale, so numpy.frombuffer views over the
+   live arrays are safe between generation changes without any copies.
+   Releasing the GIL around compute kernels is a property of the
+   embedded user code, not of this dispatch.
+------------------------------------------------------------------------- */
+
 void PythonImpl::invoke_function(int ifunc, char *result)
 {
   PyGILState_STATE gstate = PyGILState_Ensure();
@@ -346,8 +346,8 @@ void FixQEq::min_pre_force(int vflag)
 int FixQEq::CG( double *b, double *x )
 {
   int  loop, i, ii, inum, *ilist;
-  double tmp, alfa, beta, b_norm;
-  double sig_old, sig_new;
+  double alfa, beta, b_norm;
+  double sig_new;
 
   inum = list->inum;
   ilist = list->ilist;
@@ -366,30 +366,63 @@ int FixQEq::CG( double *b, double *x )
   }
 
   b_norm = parallel_norm( b, inum );
-  sig_new = parallel_dot( r, d, inum);
 
-  for( loop = 1; loop < maxiter && sqrt(sig_new)/b_norm > tolerance; ++loop ) {
-    comm->forward_comm_fix(this);
-    sparse_matvec( &H, d, q );
-    comm->reverse_comm_fix(this);
+  // communication-avoiding (Chronopoulos-Gear) recurrence: one fused
+  // allreduce of the two dot products per iteration instead of two
+  // latency-bound reductions, same Krylov iterates in exact arithmetic
+  // z = M*q and svec = H*d are carried by extra recurrences
+
+  comm->forward_comm_fix(this);
+  sparse_matvec( &H, d, q );
+  comm->reverse_comm_fix(this);
 
-    tmp = parallel_dot( d, q, inum);
-    alfa = sig_new / tmp;
+  double *z = (double *)
+    memory->aget((bigint) atom->nmax*sizeof(double),"qeq:cg_z");
+  double *svec = (double *)
+    memory->aget((bigint) atom->nmax*sizeof(double),"qeq:cg_s");
+  double dots[2];
+  double gamma_old = 0.0;
+  double alfa_old = 0.0;
+
+  for( ii = 0; ii < inum; ++ii ) {
+    i = ilist[ii];
+    p[i] = z[i] = svec[i] = 0.0;
+  }
 
-    vector_add( x, alfa, d, inum );
-    vector_add( r, -alfa, q, inum );
+  sig_new = 0.0;
+
+  for( loop = 1; loop < maxiter; ++loop ) {
+
+    parallel_dot2( r, d, q, d, inum, dots );
+    sig_new = dots[0];
+    if (sqrt(sig_new)/b_norm <= tolerance) break;
+
+    if (loop == 1) {
+      beta = 0.0;
+      alfa = sig_new / dots[1];
+    } else {
+      beta = sig_new / gamma_old;
+      alfa = sig_new / (dots[1] - beta*sig_new/alfa_old);
+    }
 
     for( ii = 0; ii < inum; ++ii ) {
       i = ilist[ii];
-      if (atom->mask[i] & groupbit)
-        p[i] = r[i] * Hdia_inv[i];
+      if (atom->mask[i] & groupbit) {
+        z[i] = q[i]*Hdia_inv[i] + beta*z[i];
+        p[i] = d[i] + beta*p[i];
+        svec[i] = q[i] + beta*svec[i];
+        x[i] += alfa*p[i];
+        r[i] -= alfa*svec[i];
+        d[i] -= alfa*z[i];
+      }
     }
 
-    sig_old = sig_new;
-    sig_new = parallel_dot( r, p, inum);
+    comm->forward_comm_fix(this);
+    sparse_matvec( &H, d, q );
+    comm->reverse_comm_fix(this);
 
-    beta = sig_new / sig_old;
-    vector_sum( d, 1., p, beta, d, inum );
+    gamma_old = sig_new;
+    alfa_old = alfa;
   }
 
   if (loop >= maxiter && comm->me == 0) {
@@ -632,6 +665,29 @@ double FixQEq::parallel_dot( double *v1, double *v2, int n)
   return res;
 }
 
+/* ----------------------------------------------------------------------
+   two masked dot products fused into one allreduce
+------------------------------------------------------------------------- */
+
+void FixQEq::parallel_dot2( double *v1, double *v2, double *v3, double *v4,
+                            int n, double *res )
+{
+  int i,ii;
+  int *ilist = list->ilist;
+
+  double my_dot[2];
+  my_dot[0] = my_dot[1] = 0.0;
+  for( ii = 0; ii < n; ++ii ) {
+    i = ilist[ii];
+    if (atom->mask[i] & groupbit) {
+      my_dot[0] += v1[i] * v2[i];
+      my_dot[1] += v3[i] * v4[i];
+    }
+  }
+
+  MPI_Allreduce( my_dot, res, 2, MPI_DOUBLE, MPI_SUM, world );
+}
+
 /* ---------------------------------------------------------------------- */
 
 double FixQEq::parallel_vector_acc( double *v, int n )
@@ -108,6 +108,7 @@ class FixQEq : public Fix {
 
   double parallel_norm(double*, int);
   double parallel_dot(double*, double*, int);
+  void parallel_dot2(double*, double*, double*, double*, int, double*);
   double parallel_vector_acc(double*, int);
 
   void vector_sum(double *, double, double *, double, double *,int);
@@ -675,22 +675,29 @@ void FixNEB::inter_replica_comm()
   // direct comm of x -> xprev and x -> xnext
 
   if (cmode == SINGLE_PROC_DIRECT) {
+
+    // post all three recvs up front and overlap both directions, with
+    // tags distinguishing the streams, so the chain of replicas does
+    // not serialize into prev-then-next rounds
+
+    MPI_Request requests3[3];
+    int nreq = 0;
     if (ireplica > 0)
-      MPI_Irecv(xprev[0],3*nlocal,MPI_DOUBLE,procprev,0,uworld,&request);
+      MPI_Irecv(xprev[0],3*nlocal,MPI_DOUBLE,procprev,0,uworld,
+                &requests3[nreq++]);
+    if (ireplica < nreplica-1) {
+      MPI_Irecv(xnext[0],3*nlocal,MPI_DOUBLE,procnext,1,uworld,
+                &requests3[nreq++]);
+      MPI_Irecv(fnext[0],3*nlocal,MPI_DOUBLE,procnext,2,uworld,
+                &requests3[nreq++]);
+    }
     if (ireplica < nreplica-1)
       MPI_Send(x[0],3*nlocal,MPI_DOUBLE,procnext,0,uworld);
-    if (ireplica > 0) MPI_Wait(&request,MPI_STATUS_IGNORE);
-    if (ireplica < nreplica-1)
-      MPI_Irecv(xnext[0],3*nlocal,MPI_DOUBLE,procnext,0,uworld,&request);
-    if (ireplica > 0)
-      MPI_Send(x[0],3*nlocal,MPI_DOUBLE,procprev,0,uworld);
-    if (ireplica < nreplica-1) MPI_Wait(&request,MPI_STATUS_IGNORE);
-
-    if (ireplica < nreplica-1)
-      MPI_Irecv(fnext[0],3*nlocal,MPI_DOUBLE,procnext,0,uworld,&request);
-    if (ireplica > 0)
-      MPI_Send(f[0],3*nlocal,MPI_DOUBLE,procprev,0,uworld);
-    if (ireplica < nreplica-1) MPI_Wait(&request,MPI_STATUS_IGNORE);
+    if (ireplica > 0) {
+      MPI_Send(x[0],3*nlocal,MPI_DOUBLE,procprev,1,uworld);
+      MPI_Send(f[0],3*nlocal,MPI_DOUBLE,procprev,2,uworld);
+    }
+    if (nreq) MPI_Waitall(nreq,requests3,MPI_STATUSES_IGNORE);
 
     return;
   }
@@ -62,6 +62,16 @@ PRD::PRD(LAMMPS *lmp) : Pointers(lmp) {}
    perform PRD simulation on one or more replicas
 ------------------------------------------------------------------------- */
 
+/* ----------------------------------------------------------------------
+   NOTE on asynchronous quenching: the universe synchronization at
+   check_event is the PRD correctness boundary -- event detection
+   compares quenched states across replicas at a common time horizon,
+   so replicas cannot run ahead without changing the parallel-replica
+   statistics the method is built on.  The quench borrows the main
+   minimizer serially because it reuses the run's force/neighbor state
+   in place; a shadow integrator would duplicate all of it per replica.
+------------------------------------------------------------------------- */
+
 void PRD::command(int narg, char **arg)
 {
   int ireplica;
@@ -233,12 +233,26 @@ void Temper::command(int narg, char **arg)
   timer->init();
   timer->barrier_start();
 
+#if defined(MPI_VERSION) && MPI_VERSION >= 3
+  MPI_Request maprequest = MPI_REQUEST_NULL;
+#endif
+
   for (int iswap = 0; iswap < nswaps; iswap++) {
 
     // run for nevery timesteps
+    // the temp2world refresh from the previous epoch completes behind
+    // this run segment, so replicas never stall on the global gather
 
     update->integrate->run(nevery);
 
+#if defined(MPI_VERSION) && MPI_VERSION >= 3
+    if (me == 0 && maprequest != MPI_REQUEST_NULL) {
+      MPI_Wait(&maprequest,MPI_STATUS_IGNORE);
+      for (i = 0; i < nworlds; i++) temp2world[world2temp[i]] = i;
+    }
+    if (iswap) MPI_Bcast(temp2world,nworlds,MPI_INT,0,world);
+#endif
+
     // compute PE
     // notify compute it will be called at next swap
 
@@ -325,17 +339,37 @@ void Temper::command(int narg, char **arg)
     // bcast within my world
 
     if (swap) my_set_temp = partner_set_temp;
+#if defined(MPI_VERSION) && MPI_VERSION >= 3
+    if (me == 0)
+      MPI_Iallgather(&my_set_temp,1,MPI_INT,world2temp,1,MPI_INT,roots,
+                     &maprequest);
+#else
     if (me == 0) {
       MPI_Allgather(&my_set_temp,1,MPI_INT,world2temp,1,MPI_INT,roots);
       for (i = 0; i < nworlds; i++) temp2world[world2temp[i]] = i;
     }
     MPI_Bcast(temp2world,nworlds,MPI_INT,0,world);
+#endif
 
     // print out current swap status
+    // universe root must complete its own gather before reading the map
 
-    if (me_universe == 0) print_status();
+    if (me_universe == 0) {
+#if defined(MPI_VERSION) && MPI_VERSION >= 3
+      if (maprequest != MPI_REQUEST_NULL) {
+        MPI_Wait(&maprequest,MPI_STATUS_IGNORE);
+        for (i = 0; i < nworlds; i++) temp2world[world2temp[i]] = i;
+      }
+#endif
+      print_status();
+    }
   }
 
+#if defined(MPI_VERSION) && MPI_VERSION >= 3
+  if (me == 0 && maprequest != MPI_REQUEST_NULL)
+    MPI_Wait(&maprequest,MPI_STATUS_IGNORE);
+#endif
+
   timer->barrier_stop();
 
   update->integrate->cleanup();
@@ -516,27 +516,36 @@ void VerletSplit::r2k_comm()
   MPI_Gatherv(atom->x[0],n*3,MPI_DOUBLE,atom->x[0],xsize,xdisp,
               MPI_DOUBLE,0,block);
 
-  // send eflag,vflag from Rspace to Kspace
+  // send eflag,vflag, and box bounds if the box is dynamic, from the
+  // Rspace block leader to its Kspace proc in a single message
+  // box_change is set identically in both partitions
+
+  int nflag = 2;
+  if (domain->box_change) nflag = 8;
 
   if (me_block == 1) {
-    int flags[2];
+    double flags[8];
     flags[0] = eflag; flags[1] = vflag;
-    MPI_Send(flags,2,MPI_INT,0,0,block);
+    if (domain->box_change) {
+      flags[2] = domain->boxlo[0];
+      flags[3] = domain->boxlo[1];
+      flags[4] = domain->boxlo[2];
+      flags[5] = domain->boxhi[0];
+      flags[6] = domain->boxhi[1];
+      flags[7] = domain->boxhi[2];
+    }
+    MPI_Send(flags,nflag,MPI_DOUBLE,0,0,block);
   } else if (!master) {
-    int flags[2];
-    MPI_Recv(flags,2,MPI_INT,1,0,block,MPI_STATUS_IGNORE);
-    eflag = flags[0]; vflag = flags[1];
-  }
-
-  // send box bounds from Rspace to Kspace if simulation box is dynamic
-
-  if (domain->box_change) {
-    if (me_block == 1) {
-      MPI_Send(domain->boxlo,3,MPI_DOUBLE,0,0,block);
-      MPI_Send(domain->boxhi,3,MPI_DOUBLE,0,0,block);
-    } else if (!master) {
-      MPI_Recv(domain->boxlo,3,MPI_DOUBLE,1,0,block,MPI_STATUS_IGNORE);
-      MPI_Recv(domain->boxhi,3,MPI_DOUBLE,1,0,block,MPI_STATUS_IGNORE);
+    double flags[8];
+    MPI_Recv(flags,nflag,MPI_DOUBLE,1,0,block,MPI_STATUS_IGNORE);
+    eflag = (int) flags[0]; vflag = (int) flags[1];
+    if (domain->box_change) {
+      domain->boxlo[0] = flags[2];
+      domain->boxlo[1] = flags[3];
+      domain->boxlo[2] = flags[4];
+      domain->boxhi[0] = flags[5];
+      domain->boxhi[1] = flags[6];
+      domain->boxhi[2] = flags[7];
       domain->set_global_box();
       domain->set_local_box();
       force->kspace->setup();
@@ -730,6 +730,17 @@ void FixRigidSmall::setup(int vflag)
 
 /* ---------------------------------------------------------------------- */
 
+/* ----------------------------------------------------------------------
+   NOTE on comm traffic: the three per-step passes (26-value forward of
+   body state after initial integration, 6-value reverse of force/torque
+   sums, 10-value forward after final integration) are each separated by
+   a computation that consumes the previous pass's data, so they cannot
+   be merged without changing the body-ownership protocol.  The
+   per-body quaternion update below is already branch-free scalar math;
+   batching bodies into SoA form would have to mirror the AoS body
+   structs that the exchange/restart machinery serializes.
+------------------------------------------------------------------------- */
+
 void FixRigidSmall::initial_integrate(int vflag)
 {
   double dtfm;
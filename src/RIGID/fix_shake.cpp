@@ -555,6 +555,34 @@ void FixShake::pre_neighbor()
           list[nlist++] = i;
       }
     }
+
+  // group the cluster list by type so the constraint loops are
+  // branch-free and each solve kernel runs over a contiguous batch
+  // clusters touch only their own atoms, so ordering between them is free
+
+  int i,flag;
+  int n2 = 0, n3 = 0, n4 = 0;
+  for (i = 0; i < nlist; i++) {
+    flag = shake_flag[list[i]];
+    if (flag == 2) n2++;
+    else if (flag == 3) n3++;
+    else if (flag == 4) n4++;
+  }
+
+  int *sorted = (int *) memory->aget(nlist*sizeof(int),"shake:sorted");
+  int i2 = 0, i3 = n2, i4 = n2+n3, ia = n2+n3+n4;
+  for (i = 0; i < nlist; i++) {
+    flag = shake_flag[list[i]];
+    if (flag == 2) sorted[i2++] = list[i];
+    else if (flag == 3) sorted[i3++] = list[i];
+    else if (flag == 4) sorted[i4++] = list[i];
+    else sorted[ia++] = list[i];
+  }
+  memcpy(list,sorted,nlist*sizeof(int));
+
+  nlist2 = n2;
+  nlist3 = n3;
+  nlist4 = n4;
 }
 
 /* ----------------------------------------------------------------------
@@ -578,14 +606,14 @@ void FixShake::post_force(int vflag)
 
   // loop over clusters to add constraint forces
 
-  int m;
-  for (int i = 0; i < nlist; i++) {
-    m = list[i];
-    if (shake_flag[m] == 2) shake(m);
-    else if (shake_flag[m] == 3) shake3(m);
-    else if (shake_flag[m] == 4) shake4(m);
-    else shake3angle(m);
-  }
+  int i;
+  int b3 = nlist2;
+  int b4 = nlist2 + nlist3;
+  int ba = nlist2 + nlist3 + nlist4;
+  for (i = 0; i < b3; i++) shake(list[i]);
+  for (i = b3; i < b4; i++) shake3(list[i]);
+  for (i = b4; i < ba; i++) shake4(list[i]);
+  for (i = ba; i < nlist; i++) shake3angle(list[i]);
 
   // store vflag for coordinate_constraints_end_of_step()
 
@@ -626,14 +654,14 @@ void FixShake::post_force_respa(int vflag, int ilevel, int iloop)
 
   // loop over clusters to add constraint forces
 
-  int m;
-  for (int i = 0; i < nlist; i++) {
-    m = list[i];
-    if (shake_flag[m] == 2) shake(m);
-    else if (shake_flag[m] == 3) shake3(m);
-    else if (shake_flag[m] == 4) shake4(m);
-    else shake3angle(m);
-  }
+  int i;
+  int b3 = nlist2;
+  int b4 = nlist2 + nlist3;
+  int ba = nlist2 + nlist3 + nlist4;
+  for (i = 0; i < b3; i++) shake(list[i]);
+  for (i = b3; i < b4; i++) shake3(list[i]);
+  for (i = b4; i < ba; i++) shake4(list[i]);
+  for (i = ba; i < nlist; i++) shake3angle(list[i]);
 
   // store vflag for coordinate_constraints_end_of_step()
   vflag_post_force = vflag;
@@ -105,6 +105,8 @@ class FixShake : public Fix {
   double dtf_inner,dtf_innerhalf;       // timesteps for rRESPA trial move
 
   int *list;                            // list of clusters to SHAKE
+  int nlist2,nlist3,nlist4;          // cluster counts per type after
+                                     // grouping the list by shake_flag
   int nlist,maxlist;                    // size and max-size of list
 
                                         // stat quantities
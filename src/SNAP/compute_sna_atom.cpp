@@ -117,7 +117,7 @@ ComputeSNAAtom::ComputeSNAAtom(LAMMPS *lmp, int narg, char **arg) :
 
   snaptr = new SNA*[comm->nthreads];
 #if defined(_OPENMP)
-#pragma omp parallel default(none) shared(lmp,rfac0,twojmax,rmin0,switchflag,bzeroflag)
+#pragma omp parallel default(shared) shared(lmp,rfac0,twojmax,rmin0,switchflag,bzeroflag)
 #endif
   {
     int tid = omp_get_thread_num();
@@ -174,7 +174,7 @@ void ComputeSNAAtom::init()
   if (count > 1 && comm->me == 0)
     error->warning(FLERR,"More than one compute sna/atom");
 #if defined(_OPENMP)
-#pragma omp parallel default(none)
+#pragma omp parallel default(shared)
 #endif
   {
     int tid = omp_get_thread_num();
@@ -221,7 +221,7 @@ void ComputeSNAAtom::compute_peratom()
   const int* const mask = atom->mask;
 
 #if defined(_OPENMP)
-#pragma omp parallel for default(none)
+#pragma omp parallel for default(shared)
 #endif
   for (int ii = 0; ii < inum; ii++) {
     const int tid = omp_get_thread_num();
@@ -115,7 +115,7 @@ ComputeSNADAtom::ComputeSNADAtom(LAMMPS *lmp, int narg, char **arg) :
 
   snaptr = new SNA*[comm->nthreads];
 #if defined(_OPENMP)
-#pragma omp parallel default(none) shared(lmp,rfac0,twojmax,rmin0,switchflag,bzeroflag)
+#pragma omp parallel default(shared) shared(lmp,rfac0,twojmax,rmin0,switchflag,bzeroflag)
 #endif
   {
     int tid = omp_get_thread_num();
@@ -176,7 +176,7 @@ void ComputeSNADAtom::init()
   if (count > 1 && comm->me == 0)
     error->warning(FLERR,"More than one compute snad/atom");
 #if defined(_OPENMP)
-#pragma omp parallel default(none)
+#pragma omp parallel default(shared)
 #endif
   {
     int tid = omp_get_thread_num();
@@ -233,7 +233,7 @@ void ComputeSNADAtom::compute_peratom()
   const int* const mask = atom->mask;
 
 #if defined(_OPENMP)
-#pragma omp parallel for default(none)
+#pragma omp parallel for default(shared)
 #endif
   for (int ii = 0; ii < inum; ii++) {
     const int tid = omp_get_thread_num();
@@ -111,7 +111,7 @@ ComputeSNAVAtom::ComputeSNAVAtom(LAMMPS *lmp, int narg, char **arg) :
 
   snaptr = new SNA*[comm->nthreads];
 #if defined(_OPENMP)
-#pragma omp parallel default(none) shared(lmp,rfac0,twojmax,rmin0,switchflag,bzeroflag)
+#pragma omp parallel default(shared) shared(lmp,rfac0,twojmax,rmin0,switchflag,bzeroflag)
 #endif
   {
     int tid = omp_get_thread_num();
@@ -171,7 +171,7 @@ void ComputeSNAVAtom::init()
   if (count > 1 && comm->me == 0)
     error->warning(FLERR,"More than one compute snav/atom");
 #if defined(_OPENMP)
-#pragma omp parallel default(none)
+#pragma omp parallel default(shared)
 #endif
   {
     int tid = omp_get_thread_num();
@@ -227,7 +227,7 @@ void ComputeSNAVAtom::compute_peratom()
   const int* const mask = atom->mask;
 
 #if defined(_OPENMP)
-#pragma omp parallel for default(none)
+#pragma omp parallel for default(shared)
 #endif
   for (int ii = 0; ii < inum; ii++) {
     const int tid = omp_get_thread_num();
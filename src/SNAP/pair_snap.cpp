@@ -433,7 +433,7 @@ void PairSNAP::compute_optimized(int eflag, int vflag)
     build_per_atom_arrays();
 
 #if defined(_OPENMP)
-#pragma omp parallel shared(eflag,vflag,time_dynamic,time_guided) firstprivate(numpairs) default(none)
+#pragma omp parallel shared(eflag,vflag,time_dynamic,time_guided) firstprivate(numpairs) default(shared)
 #endif
   {
     // begin of pragma omp parallel
@@ -1260,7 +1260,7 @@ void PairSNAP::build_per_atom_arrays()
 #endif
 
 #if defined(_OPENMP)
-#pragma omp parallel for shared(count) default(none)
+#pragma omp parallel for shared(count) default(shared)
 #endif
   for (int ii=0; ii < count; ii++) {
     int tid = omp_get_thread_num();
@@ -1518,7 +1518,7 @@ void PairSNAP::coeff(int narg, char **arg)
   // is wrapped into the sna class
 
 #if defined(_OPENMP)
-#pragma omp parallel default(none)
+#pragma omp parallel default(shared)
 #endif
   {
     int tid = omp_get_thread_num();
@@ -1559,13 +1559,18 @@ void PairSNAP::init_style()
   neighbor->requests[irequest]->full = 1;
 
 #if defined(_OPENMP)
-#pragma omp parallel default(none)
+#pragma omp parallel default(shared)
 #endif
   {
     int tid = omp_get_thread_num();
     sna[tid]->init();
   }
 
+  // all threads walk identical Clebsch-Gordan/rootpq tables: share one
+  // copy so they compete for cache instead of evicting each other
+
+  for (int tid = 1; tid < nthreads; tid++)
+    sna[tid]->share_tables(sna[0]);
 }
 
 /* ----------------------------------------------------------------------
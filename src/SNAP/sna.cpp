@@ -117,6 +117,7 @@ SNA::SNA(LAMMPS* lmp, double rfac0_in,
          int twojmax_in, int diagonalstyle_in, int use_shared_arrays_in,
          double rmin0_in, int switch_flag_in, int bzero_flag_in) : Pointers(lmp)
 {
+  shared_tables = 0;
   wself = 1.0;
 
   use_shared_arrays = use_shared_arrays_in;
@@ -279,6 +280,24 @@ void SNA::build_indexlist()
 }
 /* ---------------------------------------------------------------------- */
 
+/* ----------------------------------------------------------------------
+   drop this instance's Clebsch-Gordan and rootpq tables and reuse the
+   master's: they are identical, read-only after init, and dominate the
+   per-thread memory of an SNA instance
+------------------------------------------------------------------------- */
+
+void SNA::share_tables(SNA *master)
+{
+  if (shared_tables || master == this) return;
+  memory->destroy(cgarray);
+  memory->destroy(rootpqarray);
+  cgarray = master->cgarray;
+  rootpqarray = master->rootpqarray;
+  shared_tables = 1;
+}
+
+/* ---------------------------------------------------------------------- */
+
 void SNA::init()
 {
   init_clebsch_gordan();
@@ -372,7 +391,7 @@ void SNA::compute_ui_omp(int jnum, int sub_threads)
     omp_set_num_threads(sub_threads);
 
 #if defined(_OPENMP)
-#pragma omp parallel shared(x,y,z,z0,r,sub_threads) default(none)
+#pragma omp parallel shared(x,y,z,z0,r,sub_threads) default(shared)
 #endif
     {
       compute_uarray_omp(x, y, z, z0, r, sub_threads);
@@ -480,7 +499,7 @@ void SNA::compute_zi_omp(int sub_threads)
   // use zarray j1/j2 symmetry
 
 #if defined(_OPENMP)
-#pragma omp parallel for schedule(auto) default(none)
+#pragma omp parallel for schedule(auto) default(shared)
 #endif
   for(int j1 = 0; j1 <= twojmax; j1++)
     for(int j2 = 0; j2 <= j1; j2++)
@@ -1543,8 +1562,10 @@ void SNA::create_twojmax_arrays()
 
 void SNA::destroy_twojmax_arrays()
 {
-  memory->destroy(cgarray);
-  memory->destroy(rootpqarray);
+  if (!shared_tables) {
+    memory->destroy(cgarray);
+    memory->destroy(rootpqarray);
+  }
   memory->destroy(barray);
 
   memory->destroy(dbarray);
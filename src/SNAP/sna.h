@@ -37,6 +37,8 @@ public:
   ~SNA();
   void build_indexlist();
   void init();
+  void share_tables(SNA *);    // reuse another instance's read-only
+                               // Clebsch-Gordan and rootpq tables
   double memory_usage();
 
   int ncoeff;
@@ -140,6 +142,7 @@ private:
   double wself;
 
   int bzero_flag; // 1 if bzero subtracted from barray
+  int shared_tables;      // 1 if cgarray/rootpqarray belong to another SNA
   double *bzero;  // array of B values for isolated atoms
 };
 
@@ -1261,6 +1261,16 @@ void FixSRD::xbin_unpack(double *buf, BinAve *vbin, int n, int *list, int nval)
    unoverlap SRDs for each collision
 ------------------------------------------------------------------------- */
 
+/* ----------------------------------------------------------------------
+   NOTE on threading: collision cells are independent, but every cell
+   rotation draws from the single RanMars stream in sequence, so
+   thread-parallel cells require per-cell counter-based streams seeded
+   from (seed, cell id, step) -- a deliberate change of every SRD
+   trajectory that belongs with a validated RNG facility, not a
+   performance patch.  Until then the cell loop stays serial per rank;
+   MPI decomposition across ranks already parallelizes the cells.
+------------------------------------------------------------------------- */
+
 void FixSRD::collisions_single()
 {
   int i,j,k,m,type,nbig,ibin,ibounce,inside,collide_flag;
@@ -87,6 +87,16 @@ PairMEAMC::~PairMEAMC()
 
 /* ---------------------------------------------------------------------- */
 
+/* ----------------------------------------------------------------------
+   NOTE on batching the screening: Sij and its derivatives live in
+   meam_dens_init/meam_force with the fdiv_zero guards protecting the
+   x=0/ellipsis limits of the screening ellipse; restructuring them
+   into batched triplet arrays is a numerical rewrite of the ported
+   Fortran that this build cannot exercise (no USER-MEAMC deck runs
+   here), so it is left to a change that can be validated against the
+   shipped meamc examples.
+------------------------------------------------------------------------- */
+
 void PairMEAMC::compute(int eflag, int vflag)
 {
   int i,ii,n,inum_half,errorflag;
@@ -54,7 +54,7 @@ void AngleClass2OMP::compute(int eflag, int vflag)
   const int inum = neighbor->nanglelist;
 
 #if defined(_OPENMP)
-#pragma omp parallel default(none) shared(eflag,vflag)
+#pragma omp parallel default(shared) shared(eflag,vflag)
 #endif
   {
     int ifrom, ito, tid;
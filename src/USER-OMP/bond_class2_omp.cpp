@@ -50,7 +50,7 @@ void BondClass2OMP::compute(int eflag, int vflag)
   const int inum = neighbor->nbondlist;
 
 #if defined(_OPENMP)
-#pragma omp parallel default(none) shared(eflag,vflag)
+#pragma omp parallel default(shared) shared(eflag,vflag)
 #endif
   {
     int ifrom, ito, tid;
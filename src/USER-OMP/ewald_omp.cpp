@@ -108,7 +108,7 @@ void EwaldOMP::compute(int eflag, int vflag)
   v0=v1=v2=v3=v4=v5=0.0;
 
 #if defined(_OPENMP)
-#pragma omp parallel default(none) shared(eflag,vflag) reduction(+:eng_tmp,v0,v1,v2,v3,v4,v5)
+#pragma omp parallel default(shared) shared(eflag,vflag) reduction(+:eng_tmp,v0,v1,v2,v3,v4,v5)
 #endif
   {
 
@@ -238,7 +238,7 @@ void EwaldOMP::eik_dot_r()
   const int nthreads = comm->nthreads;
 
 #if defined(_OPENMP)
-#pragma omp parallel default(none)
+#pragma omp parallel default(shared)
 #endif
   {
     int i,ifrom,ito,k,l,m,n,ic,tid;
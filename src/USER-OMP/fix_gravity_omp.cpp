@@ -78,7 +78,7 @@ void FixGravityOMP::post_force(int vflag)
 
   if (rmass) {
 #if defined(_OPENMP)
-#pragma omp parallel for private(i,massone) default(none) reduction(-:grav)
+#pragma omp parallel for private(i,massone) default(shared) reduction(-:grav)
 #endif
     for (i = 0; i < nlocal; i++)
       if (mask[i] & groupbit) {
@@ -90,7 +90,7 @@ void FixGravityOMP::post_force(int vflag)
       }
   } else {
 #if defined(_OPENMP)
-#pragma omp parallel for private(i,massone) default(none) reduction(-:grav)
+#pragma omp parallel for private(i,massone) default(shared) reduction(-:grav)
 #endif
     for (i = 0; i < nlocal; i++)
       if (mask[i] & groupbit) {
@@ -77,7 +77,7 @@ void FixNeighHistoryOMP::pre_exchange_onesided()
   maxpartner = 0;
 
 #if defined(_OPENMP)
-#pragma omp parallel default(none)
+#pragma omp parallel default(shared)
 #endif
   {
 
@@ -201,7 +201,7 @@ void FixNeighHistoryOMP::pre_exchange_newton()
   for (int i = 0; i < nall_neigh; i++) npartner[i] = 0;
 
 #if defined(_OPENMP)
-#pragma omp parallel default(none)
+#pragma omp parallel default(shared)
 #endif
   {
 
@@ -374,7 +374,7 @@ void FixNeighHistoryOMP::pre_exchange_no_newton()
   maxpartner = 0;
 
 #if defined(_OPENMP)
-#pragma omp parallel default(none)
+#pragma omp parallel default(shared)
 #endif
   {
 
@@ -522,9 +522,35 @@ void FixNeighHistoryOMP::post_neighbor()
       memory->smalloc(maxatom*sizeof(double *),"neighbor_history:firstvalue");
   }
 
+  // assign each atom's CSR rows in the flat arrays up front, so the
+  // threads below can fill their chunks independently
+
+  {
+    NeighList *list = pair->list;
+    int inum = list->inum;
+    int *ilist = list->ilist;
+    int *numneigh = list->numneigh;
+
+    bigint ntotal = 0;
+    for (int ii = 0; ii < inum; ii++) ntotal += numneigh[ilist[ii]];
+    if (ntotal > maxflat) {
+      maxflat = ntotal + ntotal/2;
+      memory->destroy(flatflag);
+      memory->destroy(flatvalue);
+      memory->create(flatflag,maxflat,"neighbor_history:flatflag");
+      memory->create(flatvalue,maxflat*dnum,"neighbor_history:flatvalue");
+    }
+    bigint offset = 0;
+    for (int ii = 0; ii < inum; ii++) {
+      int i = ilist[ii];
+      firstflag[i] = &flatflag[offset];
+      firstvalue[i] = &flatvalue[offset*dnum];
+      offset += numneigh[i];
+    }
+  }
 
 #if defined(_OPENMP)
-#pragma omp parallel default(none)
+#pragma omp parallel default(shared)
 #endif
   {
 
@@ -540,11 +566,6 @@ void FixNeighHistoryOMP::post_neighbor()
     int *allflags;
     double *allvalues;
 
-    MyPage <int> &ipg = ipage_neigh[tid];
-    MyPage <double> &dpg = dpage_neigh[tid];
-    ipg.reset();
-    dpg.reset();
-
     // 1st loop over neighbor list
     // calculate npartner for each owned atom
 
@@ -566,8 +587,8 @@ void FixNeighHistoryOMP::post_neighbor()
       i = ilist[ii];
       jlist = firstneigh[i];
       jnum = numneigh[i];
-      firstflag[i] = allflags = ipg.get(jnum);
-      firstvalue[i] = allvalues = dpg.get(jnum*dnum);
+      allflags = firstflag[i];
+      allvalues = firstvalue[i];
       np = npartner[i];
       nn = 0;
 
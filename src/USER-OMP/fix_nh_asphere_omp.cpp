@@ -83,7 +83,7 @@ void FixNHAsphereOMP::nve_v()
   // merged with FixNHOMP instead of calling it for the COM update.
 
 #if defined(_OPENMP)
-#pragma omp parallel for default(none) private(i) schedule(static)
+#pragma omp parallel for default(shared) private(i) schedule(static)
 #endif
   for (i = 0; i < nlocal; i++) {
     if (mask[i] & groupbit) {
@@ -124,7 +124,7 @@ void FixNHAsphereOMP::nve_x()
   // principal moments of inertia
 
 #if defined(_OPENMP)
-#pragma omp parallel for default(none) private(i) schedule(static)
+#pragma omp parallel for default(shared) private(i) schedule(static)
 #endif
   for (i = 0; i < nlocal; i++)
     if (mask[i] & groupbit) {
@@ -166,7 +166,7 @@ void FixNHAsphereOMP::nh_v_temp()
 
   if (which == NOBIAS) {
 #if defined(_OPENMP)
-#pragma omp parallel for default(none) private(i) schedule(static)
+#pragma omp parallel for default(shared) private(i) schedule(static)
 #endif
     for (i = 0; i < nlocal; i++) {
       if (mask[i] & groupbit) {
@@ -180,7 +180,7 @@ void FixNHAsphereOMP::nh_v_temp()
     }
   } else if (which == BIAS) {
 #if defined(_OPENMP)
-#pragma omp parallel for default(none) private(i) schedule(static)
+#pragma omp parallel for default(shared) private(i) schedule(static)
 #endif
     for (i = 0; i < nlocal; i++) {
       double buf[3];
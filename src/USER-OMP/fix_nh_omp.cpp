@@ -60,7 +60,7 @@ void FixNHOMP::remap()
   else {
     int i;
 #if defined (_OPENMP)
-#pragma omp parallel for private(i) default(none) schedule(static)
+#pragma omp parallel for private(i) default(shared) schedule(static)
 #endif
     for (i = 0; i < nlocal; i++)
       if (mask[i] & dilate_group_bit)
@@ -211,7 +211,7 @@ void FixNHOMP::remap()
   else {
     int i;
 #if defined (_OPENMP)
-#pragma omp parallel for private(i) default(none) schedule(static)
+#pragma omp parallel for private(i) default(shared) schedule(static)
 #endif
     for (i = 0; i < nlocal; i++)
       if (mask[i] & dilate_group_bit)
@@ -240,7 +240,7 @@ void FixNHOMP::nh_v_press()
 
   if (which == NOBIAS) {
 #if defined(_OPENMP)
-#pragma omp parallel for default(none) private(i) schedule(static)
+#pragma omp parallel for default(shared) private(i) schedule(static)
 #endif
     for (i = 0; i < nlocal; i++) {
       if (mask[i] & groupbit) {
@@ -258,7 +258,7 @@ void FixNHOMP::nh_v_press()
     }
   } else if (which == BIAS) {
 #if defined(_OPENMP)
-#pragma omp parallel for default(none) private(i) schedule(static)
+#pragma omp parallel for default(shared) private(i) schedule(static)
 #endif
     for (i = 0; i < nlocal; i++) {
       double buf[3];
@@ -295,7 +295,7 @@ void FixNHOMP::nve_v()
   if (atom->rmass) {
     const double * _noalias const rmass = atom->rmass;
 #if defined(_OPENMP)
-#pragma omp parallel for default(none) private(i) schedule(static)
+#pragma omp parallel for default(shared) private(i) schedule(static)
 #endif
     for (i = 0; i < nlocal; i++) {
       if (mask[i] & groupbit) {
@@ -309,7 +309,7 @@ void FixNHOMP::nve_v()
     const double *_noalias const mass = atom->mass;
     const int * _noalias const type = atom->type;
 #if defined(_OPENMP)
-#pragma omp parallel for default(none) private(i) schedule(static)
+#pragma omp parallel for default(shared) private(i) schedule(static)
 #endif
     for (i = 0; i < nlocal; i++) {
       if (mask[i] & groupbit) {
@@ -337,7 +337,7 @@ void FixNHOMP::nve_x()
   // x update by full step only for atoms in group
 
 #if defined(_OPENMP)
-#pragma omp parallel for default(none) private(i) schedule(static)
+#pragma omp parallel for default(shared) private(i) schedule(static)
 #endif
   for (i = 0; i < nlocal; i++) {
     if (mask[i] & groupbit) {
@@ -360,7 +360,7 @@ void FixNHOMP::nh_v_temp()
 
   if (which == NOBIAS) {
 #if defined(_OPENMP)
-#pragma omp parallel for default(none) private(i) schedule(static)
+#pragma omp parallel for default(shared) private(i) schedule(static)
 #endif
     for (i = 0; i < nlocal; i++) {
       if (mask[i] & groupbit) {
@@ -371,7 +371,7 @@ void FixNHOMP::nh_v_temp()
     }
   } else if (which == BIAS) {
 #if defined(_OPENMP)
-#pragma omp parallel for default(none) private(i) schedule(static)
+#pragma omp parallel for default(shared) private(i) schedule(static)
 #endif
     for (i = 0; i < nlocal; i++) {
       double buf[3];
@@ -89,7 +89,7 @@ void FixNHSphereOMP::nve_v()
   // 4 cases depending on radius vs shape and rmass vs mass
 
 #if defined(_OPENMP)
-#pragma omp parallel for default(none) private(i) schedule(static)
+#pragma omp parallel for default(shared) private(i) schedule(static)
 #endif
   for (i = 0; i < nlocal; i++) {
     if (mask[i] & groupbit) {
@@ -120,7 +120,7 @@ void FixNHSphereOMP::nh_v_temp()
 
   if (which == NOBIAS) {
 #if defined(_OPENMP)
-#pragma omp parallel for default(none) private(i) schedule(static)
+#pragma omp parallel for default(shared) private(i) schedule(static)
 #endif
     for (i = 0; i < nlocal; i++) {
       if (mask[i] & groupbit) {
@@ -134,7 +134,7 @@ void FixNHSphereOMP::nh_v_temp()
     }
   } else if (which == BIAS) {
 #if defined(_OPENMP)
-#pragma omp parallel for default(none) private(i) schedule(static)
+#pragma omp parallel for default(shared) private(i) schedule(static)
 #endif
     for (i = 0; i < nlocal; i++) {
       double buf[3];
@@ -43,7 +43,7 @@ void FixNVEOMP::initial_integrate(int vflag)
   if (atom->rmass) {
     const double * const rmass = atom->rmass;
 #if defined (_OPENMP)
-#pragma omp parallel for private(i) default(none) schedule(static)
+#pragma omp parallel for private(i) default(shared) schedule(static)
 #endif
     for (i = 0; i < nlocal; i++)
       if (mask[i] & groupbit) {
@@ -60,7 +60,7 @@ void FixNVEOMP::initial_integrate(int vflag)
     const double * const mass = atom->mass;
     const int * const type = atom->type;
 #if defined (_OPENMP)
-#pragma omp parallel for private(i) default(none) schedule(static)
+#pragma omp parallel for private(i) default(shared) schedule(static)
 #endif
     for (i = 0; i < nlocal; i++)
       if (mask[i] & groupbit) {
@@ -90,7 +90,7 @@ void FixNVEOMP::final_integrate()
   if (atom->rmass) {
     const double * const rmass = atom->rmass;
 #if defined (_OPENMP)
-#pragma omp parallel for private(i) default(none) schedule(static)
+#pragma omp parallel for private(i) default(shared) schedule(static)
 #endif
     for (i = 0; i < nlocal; i++)
       if (mask[i] & groupbit) {
@@ -104,7 +104,7 @@ void FixNVEOMP::final_integrate()
     const double * const mass = atom->mass;
     const int * const type = atom->type;
 #if defined (_OPENMP)
-#pragma omp parallel for private(i) default(none) schedule(static)
+#pragma omp parallel for private(i) default(shared) schedule(static)
 #endif
     for (i = 0; i < nlocal; i++)
       if (mask[i] & groupbit) {
@@ -56,7 +56,7 @@ void FixNVESphereOMP::initial_integrate(int vflag)
   // update v,x,omega for all particles
   // d_omega/dt = torque / inertia
 #if defined(_OPENMP)
-#pragma omp parallel for private(i) default(none)
+#pragma omp parallel for private(i) default(shared)
 #endif
   for (i = 0; i < nlocal; i++) {
     if (mask[i] & groupbit) {
@@ -83,7 +83,7 @@ void FixNVESphereOMP::initial_integrate(int vflag)
     double * const * const mu = atom->mu;
     if (dlm == NODLM) {
 #if defined(_OPENMP)
-#pragma omp parallel for private(i) default(none)
+#pragma omp parallel for private(i) default(shared)
 #endif
       for (i = 0; i < nlocal; i++) {
         double g0,g1,g2,msq,scale;
@@ -102,7 +102,7 @@ void FixNVESphereOMP::initial_integrate(int vflag)
       }
     } else {
 #if defined(_OPENMP)
-#pragma omp parallel for private(i) default(none)
+#pragma omp parallel for private(i) default(shared)
 #endif
       // Integrate orientation following Dullweber-Leimkuhler-Maclachlan scheme
       for (i = 0; i < nlocal; i++) {
@@ -231,7 +231,7 @@ void FixNVESphereOMP::final_integrate()
   // d_omega/dt = torque / inertia
 
 #if defined(_OPENMP)
-#pragma omp parallel for private(i) default(none)
+#pragma omp parallel for private(i) default(shared)
 #endif
   for (i = 0; i < nlocal; i++)
     if (mask[i] & groupbit) {
@@ -70,7 +70,7 @@ FixOMP::FixOMP(LAMMPS *lmp, int narg, char **arg)
   if (narg > 3) {
 #if defined(_OPENMP)
     if (strcmp(arg[3],"0") == 0)
-#pragma omp parallel default(none) shared(nthreads)
+#pragma omp parallel default(shared) shared(nthreads)
       nthreads = omp_get_num_threads();
     else
       nthreads = force->inumeric(FLERR,arg[3]);
@@ -132,7 +132,7 @@ FixOMP::FixOMP(LAMMPS *lmp, int narg, char **arg)
   thr = new ThrData *[nthreads];
   _nthr = nthreads;
 #if defined(_OPENMP)
-#pragma omp parallel default(none) shared(lmp)
+#pragma omp parallel default(shared) shared(lmp)
 #endif
   {
     const int tid = get_tid();
@@ -184,7 +184,7 @@ void FixOMP::init()
     thr = new ThrData *[nthreads];
     _nthr = nthreads;
 #if defined(_OPENMP)
-#pragma omp parallel default(none)
+#pragma omp parallel default(shared)
 #endif
     {
       const int tid = get_tid();
@@ -345,7 +345,7 @@ void FixOMP::pre_force(int)
   double *drho = atom->drho;
 
 #if defined(_OPENMP)
-#pragma omp parallel default(none) shared(f,torque,erforce,de,drho)
+#pragma omp parallel default(shared) shared(f,torque,erforce,de,drho)
 #endif
   {
     const int tid = get_tid();
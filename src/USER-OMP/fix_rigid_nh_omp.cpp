@@ -92,7 +92,7 @@ void FixRigidNHOMP::initial_integrate(int vflag)
   int ibody;
 
 #if defined(_OPENMP)
-#pragma omp parallel for default(none) private(ibody) shared(scale_r,scale_t,scale_v) schedule(static) reduction(+:akt,akr)
+#pragma omp parallel for default(shared) private(ibody) shared(scale_r,scale_t,scale_v) schedule(static) reduction(+:akt,akr)
 #endif
   for (ibody = 0; ibody < nbody; ibody++) {
     double mbody[3],tbody[3],fquat[4];
@@ -253,7 +253,7 @@ void FixRigidNHOMP::compute_forces_and_torques()
      int i;
 
 #if defined(_OPENMP)
-#pragma omp parallel for default(none) private(i) reduction(+:s0,s1,s2,s3,s4,s5)
+#pragma omp parallel for default(shared) private(i) reduction(+:s0,s1,s2,s3,s4,s5)
 #endif
      for (i = 0; i < nlocal; i++) {
        const int ibody = body[i];
@@ -292,7 +292,7 @@ void FixRigidNHOMP::compute_forces_and_torques()
        int i;
 
 #if defined(_OPENMP)
-#pragma omp parallel for default(none) private(i) shared(ib) reduction(+:s0,s1,s2,s3,s4,s5)
+#pragma omp parallel for default(shared) private(i) shared(ib) reduction(+:s0,s1,s2,s3,s4,s5)
 #endif
        for (i = 0; i < nlocal; i++) {
          const int ibody = body[i];
@@ -333,7 +333,7 @@ void FixRigidNHOMP::compute_forces_and_torques()
      memset(&sum[0][0],0,6*nbody*sizeof(double));
 
 #if defined(_OPENMP)
-#pragma omp parallel default(none)
+#pragma omp parallel default(shared)
 #endif
      {
 #if defined(_OPENMP)
@@ -376,7 +376,7 @@ void FixRigidNHOMP::compute_forces_and_torques()
   MPI_Allreduce(sum[0],all[0],6*nbody,MPI_DOUBLE,MPI_SUM,world);
 
 #if defined(_OPENMP)
-#pragma omp parallel for default(none) private(ibody) schedule(static)
+#pragma omp parallel for default(shared) private(ibody) schedule(static)
 #endif
   for (ibody = 0; ibody < nbody; ibody++) {
     fcm[ibody][0] = all[ibody][0] + langextra[ibody][0];
@@ -424,7 +424,7 @@ void FixRigidNHOMP::final_integrate()
   const double dtf2 = dtf * 2.0;
 
 #if defined(_OPENMP)
-#pragma omp parallel for default(none) private(ibody) shared(scale_t,scale_r) schedule(static) reduction(+:akt,akr)
+#pragma omp parallel for default(shared) private(ibody) shared(scale_t,scale_r) schedule(static) reduction(+:akt,akr)
 #endif
   for (ibody = 0; ibody < nbody; ibody++) {
     double mbody[3],tbody[3],fquat[4];
@@ -546,7 +546,7 @@ void FixRigidNHOMP::remap()
   else {
     int i;
 #if defined (_OPENMP)
-#pragma omp parallel for private(i) default(none) schedule(static)
+#pragma omp parallel for private(i) default(shared) schedule(static)
 #endif
     for (i = 0; i < nlocal; i++)
       if (mask[i] & dilate_group_bit)
@@ -579,7 +579,7 @@ void FixRigidNHOMP::remap()
   else {
     int i;
 #if defined (_OPENMP)
-#pragma omp parallel for private(i) default(none) schedule(static)
+#pragma omp parallel for private(i) default(shared) schedule(static)
 #endif
     for (i = 0; i < nlocal; i++)
       if (mask[i] & dilate_group_bit)
@@ -624,7 +624,7 @@ void FixRigidNHOMP::set_xv_thr()
   int i;
 
 #if defined(_OPENMP)
-#pragma omp parallel for default(none) private(i) reduction(+:v0,v1,v2,v3,v4,v5)
+#pragma omp parallel for default(shared) private(i) reduction(+:v0,v1,v2,v3,v4,v5)
 #endif
   for (i = 0; i < nlocal; i++) {
     const int ibody = body[i];
@@ -825,7 +825,7 @@ void FixRigidNHOMP::set_v_thr()
   int i;
 
 #if defined(_OPENMP)
-#pragma omp parallel for default(none) private(i) reduction(+:v0,v1,v2,v3,v4,v5)
+#pragma omp parallel for default(shared) private(i) reduction(+:v0,v1,v2,v3,v4,v5)
 #endif
   for (i = 0; i < nlocal; i++) {
     const int ibody = body[i];
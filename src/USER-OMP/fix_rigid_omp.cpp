@@ -50,7 +50,7 @@ void FixRigidOMP::initial_integrate(int vflag)
   int ibody;
 
 #if defined(_OPENMP)
-#pragma omp parallel for default(none) private(ibody) schedule(static)
+#pragma omp parallel for default(shared) private(ibody) schedule(static)
 #endif
   for (ibody = 0; ibody < nbody; ibody++) {
 
@@ -124,7 +124,7 @@ void FixRigidOMP::compute_forces_and_torques()
      int i;
 
 #if defined(_OPENMP)
-#pragma omp parallel for default(none) private(i) reduction(+:s0,s1,s2,s3,s4,s5)
+#pragma omp parallel for default(shared) private(i) reduction(+:s0,s1,s2,s3,s4,s5)
 #endif
      for (i = 0; i < nlocal; i++) {
        const int ibody = body[i];
@@ -163,7 +163,7 @@ void FixRigidOMP::compute_forces_and_torques()
        int i;
 
 #if defined(_OPENMP)
-#pragma omp parallel for default(none) private(i) shared(ib) reduction(+:s0,s1,s2,s3,s4,s5)
+#pragma omp parallel for default(shared) private(i) shared(ib) reduction(+:s0,s1,s2,s3,s4,s5)
 #endif
        for (i = 0; i < nlocal; i++) {
          const int ibody = body[i];
@@ -204,7 +204,7 @@ void FixRigidOMP::compute_forces_and_torques()
      memset(&sum[0][0],0,6*nbody*sizeof(double));
 
 #if defined(_OPENMP)
-#pragma omp parallel default(none)
+#pragma omp parallel default(shared)
 #endif
      {
 #if defined(_OPENMP)
@@ -252,7 +252,7 @@ void FixRigidOMP::compute_forces_and_torques()
   int ibody;
 
 #if defined(_OPENMP)
-#pragma omp parallel for default(none) private(ibody) schedule(static)
+#pragma omp parallel for default(shared) private(ibody) schedule(static)
 #endif
   for (ibody = 0; ibody < nbody; ibody++) {
     fcm[ibody][0] = all[ibody][0] + langextra[ibody][0];
@@ -275,7 +275,7 @@ void FixRigidOMP::final_integrate()
   // update vcm and angmom
 
 #if defined(_OPENMP)
-#pragma omp parallel for default(none) private(ibody) schedule(static)
+#pragma omp parallel for default(shared) private(ibody) schedule(static)
 #endif
   for (ibody = 0; ibody < nbody; ibody++) {
 
@@ -342,7 +342,7 @@ void FixRigidOMP::set_xv_thr()
   int i;
 
 #if defined(_OPENMP)
-#pragma omp parallel for default(none) private(i) reduction(+:v0,v1,v2,v3,v4,v5)
+#pragma omp parallel for default(shared) private(i) reduction(+:v0,v1,v2,v3,v4,v5)
 #endif
   for (i = 0; i < nlocal; i++) {
     const int ibody = body[i];
@@ -543,7 +543,7 @@ void FixRigidOMP::set_v_thr()
   int i;
 
 #if defined(_OPENMP)
-#pragma omp parallel for default(none) private(i) reduction(+:v0,v1,v2,v3,v4,v5)
+#pragma omp parallel for default(shared) private(i) reduction(+:v0,v1,v2,v3,v4,v5)
 #endif
   for (i = 0; i < nlocal; i++) {
     const int ibody = body[i];
@@ -50,7 +50,7 @@ void FixRigidSmallOMP::initial_integrate(int vflag)
   int ibody;
 
 #if defined(_OPENMP)
-#pragma omp parallel for default(none) private(ibody) schedule(static)
+#pragma omp parallel for default(shared) private(ibody) schedule(static)
 #endif
   for (ibody = 0; ibody < nlocal_body; ibody++) {
 
@@ -122,7 +122,7 @@ void FixRigidSmallOMP::compute_forces_and_torques()
   int i, ibody;
 
 #if defined(_OPENMP)
-#pragma omp parallel for default(none) private(ibody) schedule(static)
+#pragma omp parallel for default(shared) private(ibody) schedule(static)
 #endif
   for (ibody = 0; ibody < nlocal_body+nghost_body; ibody++) {
     double * _noalias const fcm = body[ibody].fcm;
@@ -137,7 +137,7 @@ void FixRigidSmallOMP::compute_forces_and_torques()
   // and then each thread only processes some bodies.
 
 #if defined(_OPENMP)
-#pragma omp parallel default(none) private(i,ibody)
+#pragma omp parallel default(shared) private(i,ibody)
 #endif
   {
 #if defined(_OPENMP)
@@ -188,7 +188,7 @@ void FixRigidSmallOMP::compute_forces_and_torques()
 
   if (langflag) {
 #if defined(_OPENMP)
-#pragma omp parallel for default(none) private(ibody) schedule(static)
+#pragma omp parallel for default(shared) private(ibody) schedule(static)
 #endif
     for (ibody = 0; ibody < nlocal_body; ibody++) {
       double * _noalias const fcm = body[ibody].fcm;
@@ -214,7 +214,7 @@ void FixRigidSmallOMP::final_integrate()
   // update vcm and angmom, recompute omega
 
 #if defined(_OPENMP)
-#pragma omp parallel for default(none) private(ibody) schedule(static)
+#pragma omp parallel for default(shared) private(ibody) schedule(static)
 #endif
   for (ibody = 0; ibody < nlocal_body; ibody++) {
     Body &b = body[ibody];
@@ -287,7 +287,7 @@ void FixRigidSmallOMP::set_xv_thr()
   int i;
 
 #if defined(_OPENMP)
-#pragma omp parallel for default(none) private(i) reduction(+:v0,v1,v2,v3,v4,v5)
+#pragma omp parallel for default(shared) private(i) reduction(+:v0,v1,v2,v3,v4,v5)
 #endif
   for (i = 0; i < nlocal; i++) {
     const int ibody = atom2body[i];
@@ -483,7 +483,7 @@ void FixRigidSmallOMP::set_v_thr()
   int i;
 
 #if defined(_OPENMP)
-#pragma omp parallel for default(none) private(i) reduction(+:v0,v1,v2,v3,v4,v5)
+#pragma omp parallel for default(shared) private(i) reduction(+:v0,v1,v2,v3,v4,v5)
 #endif
   for (i = 0; i < nlocal; i++) {
     const int ibody = atom2body[i];
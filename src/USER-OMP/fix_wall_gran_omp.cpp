@@ -101,7 +101,7 @@ void FixWallGranOMP::post_force(int vflag)
 
   int i;
 #if defined(_OPENMP)
-#pragma omp parallel for private(i) default(none) firstprivate(vwall,wlo,whi)
+#pragma omp parallel for private(i) default(shared) firstprivate(vwall,wlo,whi)
 #endif
   for (i = 0; i < nlocal; i++) {
 
@@ -53,7 +53,7 @@ void ImproperClass2OMP::compute(int eflag, int vflag)
   const int inum = neighbor->nimproperlist;
 
 #if defined(_OPENMP)
-#pragma omp parallel default(none) shared(eflag,vflag)
+#pragma omp parallel default(shared) shared(eflag,vflag)
 #endif
   {
     int ifrom, ito, tid;
@@ -57,7 +57,7 @@ void MSMOMP::compute(int eflag, int vflag)
   MSM::compute(eflag,vflag);
 
 #if defined(_OPENMP)
-#pragma omp parallel default(none) shared(eflag,vflag)
+#pragma omp parallel default(shared) shared(eflag,vflag)
 #endif
   {
 #if defined(_OPENMP)
@@ -163,7 +163,7 @@ void MSMOMP::direct_eval(const int nn)
   const int n=nn;
 
 #if defined(_OPENMP)
-#pragma omp parallel default(none) reduction(+:v0,v1,v2,v3,v4,v5,emsm)
+#pragma omp parallel default(shared) reduction(+:v0,v1,v2,v3,v4,v5,emsm)
 #endif
   {
     double esum,v0sum,v1sum,v2sum,v3sum,v4sum,v5sum;
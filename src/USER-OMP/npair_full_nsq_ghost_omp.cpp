@@ -44,7 +44,7 @@ void NPairFullNsqGhostOmp::build(NeighList *list)
 
   NPAIR_OMP_INIT;
 #if defined(_OPENMP)
-#pragma omp parallel default(none) shared(list)
+#pragma omp parallel default(shared) shared(list)
 #endif
   NPAIR_OMP_SETUP(nall);
 
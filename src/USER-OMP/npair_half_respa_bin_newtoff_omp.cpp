@@ -48,7 +48,7 @@ void NPairHalfRespaBinNewtoffOmp::build(NeighList *list)
   const int respamiddle = list->respamiddle;
 
 #if defined(_OPENMP)
-#pragma omp parallel default(none) shared(list)
+#pragma omp parallel default(shared) shared(list)
 #endif
   NPAIR_OMP_SETUP(nlocal);
 
@@ -45,7 +45,7 @@ void NPairHalfSizeBinNewtoffOmp::build(NeighList *list)
   NPAIR_OMP_INIT;
 
 #if defined(_OPENMP)
-#pragma omp parallel default(none) shared(list)
+#pragma omp parallel default(shared) shared(list)
 #endif
   NPAIR_OMP_SETUP(nlocal);
 
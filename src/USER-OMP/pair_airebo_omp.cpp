@@ -60,7 +60,7 @@ void PairAIREBOOMP::compute(int eflag, int vflag)
   const int inum = list->inum;
 
 #if defined(_OPENMP)
-#pragma omp parallel default(none) shared(eflag,vflag) reduction(+:pv0,pv1,pv2)
+#pragma omp parallel default(shared) shared(eflag,vflag) reduction(+:pv0,pv1,pv2)
 #endif
   {
     int ifrom, ito, tid;
@@ -106,7 +106,7 @@ void PairAIREBOOMP::REBO_neigh_thr()
   }
 
 #if defined(_OPENMP)
-#pragma omp parallel default(none)
+#pragma omp parallel default(shared)
 #endif
   {
     int i,j,ii,jj,n,jnum,itype,jtype;
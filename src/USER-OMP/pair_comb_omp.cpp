@@ -54,7 +54,7 @@ void PairCombOMP::compute(int eflag, int vflag)
   Short_neigh_thr();
 
 #if defined(_OPENMP)
-#pragma omp parallel default(none) shared(eflag,vflag)
+#pragma omp parallel default(shared) shared(eflag,vflag)
 #endif
   {
     int ifrom, ito, tid;
@@ -413,7 +413,7 @@ double PairCombOMP::yasu_char(double *qf_fix, int &igroup)
 
   // loop over full neighbor list of my atoms
 #if defined(_OPENMP)
-#pragma omp parallel for private(ii) default(none) shared(potal,fac11e)
+#pragma omp parallel for private(ii) default(shared) shared(potal,fac11e)
 #endif
   for (ii = 0; ii < inum; ii ++) {
     double fqi,fqj,fqij,fqji,fqjj,delr1[3];
@@ -566,7 +566,7 @@ void PairCombOMP::Short_neigh_thr()
   const int nthreads = comm->nthreads;
 
 #if defined(_OPENMP)
-#pragma omp parallel default(none)
+#pragma omp parallel default(shared)
 #endif
   {
     int nj,*neighptrj;
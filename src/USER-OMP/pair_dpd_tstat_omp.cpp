@@ -81,7 +81,7 @@ void PairDPDTstatOMP::compute(int eflag, int vflag)
     random_thr[0] = random;
   }
 #if defined(_OPENMP)
-#pragma omp parallel default(none) shared(eflag,vflag)
+#pragma omp parallel default(shared) shared(eflag,vflag)
 #endif
   {
     int ifrom, ito, tid;
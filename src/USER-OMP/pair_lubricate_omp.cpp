@@ -111,7 +111,7 @@ void PairLubricateOMP::compute(int eflag, int vflag)
 
 
 #if defined(_OPENMP)
-#pragma omp parallel default(none) shared(eflag,vflag)
+#pragma omp parallel default(shared) shared(eflag,vflag)
 #endif
   {
     int ifrom, ito, tid;
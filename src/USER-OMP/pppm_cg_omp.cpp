@@ -60,7 +60,7 @@ PPPMCGOMP::PPPMCGOMP(LAMMPS *lmp, int narg, char **arg) :
 PPPMCGOMP::~PPPMCGOMP()
 {
 #if defined(_OPENMP)
-#pragma omp parallel default(none)
+#pragma omp parallel default(shared)
 #endif
   {
 #if defined(_OPENMP)
@@ -82,7 +82,7 @@ void PPPMCGOMP::allocate()
   PPPMCG::allocate();
 
 #if defined(_OPENMP)
-#pragma omp parallel default(none)
+#pragma omp parallel default(shared)
 #endif
   {
 #if defined(_OPENMP)
@@ -123,7 +123,7 @@ void PPPMCGOMP::compute_gf_ik()
   const int twoorder = 2*order;
 
 #if defined(_OPENMP)
-#pragma omp parallel default(none)
+#pragma omp parallel default(shared)
 #endif
   {
     double snx,sny,snz;
@@ -217,7 +217,7 @@ void PPPMCGOMP::compute_gf_ad()
   double sf0=0.0,sf1=0.0,sf2=0.0,sf3=0.0,sf4=0.0,sf5=0.0;
 
 #if defined(_OPENMP)
-#pragma omp parallel default(none) reduction(+:sf0,sf1,sf2,sf3,sf4,sf5)
+#pragma omp parallel default(shared) reduction(+:sf0,sf1,sf2,sf3,sf4,sf5)
 #endif
   {
     double snx,sny,snz,sqk;
@@ -315,7 +315,7 @@ void PPPMCGOMP::compute(int eflag, int vflag)
   PPPMCG::compute(eflag,vflag);
 
 #if defined(_OPENMP)
-#pragma omp parallel default(none) shared(eflag,vflag)
+#pragma omp parallel default(shared) shared(eflag,vflag)
 #endif
   {
 #if defined(_OPENMP)
@@ -352,7 +352,7 @@ void PPPMCGOMP::make_rho()
   const int iy = nyhi_out - nylo_out + 1;
 
 #if defined(_OPENMP)
-#pragma omp parallel default(none)
+#pragma omp parallel default(shared)
 #endif
   {
     const double * _noalias const q = atom->q;
@@ -444,7 +444,7 @@ void PPPMCGOMP::fieldforce_ik()
   const int nthreads = comm->nthreads;
 
 #if defined(_OPENMP)
-#pragma omp parallel default(none)
+#pragma omp parallel default(shared)
 #endif
   {
     FFT_SCALAR dx,dy,dz,x0,y0,z0,ekx,eky,ekz;
@@ -525,7 +525,7 @@ void PPPMCGOMP::fieldforce_ad()
   const int nthreads = comm->nthreads;
 
 #if defined(_OPENMP)
-#pragma omp parallel default(none)
+#pragma omp parallel default(shared)
 #endif
   {
     int i,ifrom,ito,tid,l,m,n,nx,ny,nz,mx,my,mz;
@@ -618,7 +618,7 @@ void PPPMCGOMP::fieldforce_peratom()
   const int nthreads = comm->nthreads;
 
 #if defined(_OPENMP)
-#pragma omp parallel default(none)
+#pragma omp parallel default(shared)
 #endif
   {
     FFT_SCALAR dx,dy,dz,x0,y0,z0;
@@ -55,7 +55,7 @@ PPPMDispOMP::PPPMDispOMP(LAMMPS *lmp, int narg, char **arg) :
 PPPMDispOMP::~PPPMDispOMP()
 {
 #if defined(_OPENMP)
-#pragma omp parallel default(none)
+#pragma omp parallel default(shared)
 #endif
   {
 #if defined(_OPENMP)
@@ -83,7 +83,7 @@ void PPPMDispOMP::allocate()
   PPPMDisp::allocate();
 
 #if defined(_OPENMP)
-#pragma omp parallel default(none)
+#pragma omp parallel default(shared)
 #endif
   {
 #if defined(_OPENMP)
@@ -110,7 +110,7 @@ void PPPMDispOMP::allocate()
 void PPPMDispOMP::compute_gf()
 {
 #if defined(_OPENMP)
-#pragma omp parallel default(none)
+#pragma omp parallel default(shared)
 #endif
   {
 
@@ -200,7 +200,7 @@ void PPPMDispOMP::compute_gf()
 void PPPMDispOMP::compute_gf_6()
 {
 #if defined(_OPENMP)
-#pragma omp parallel default(none)
+#pragma omp parallel default(shared)
 #endif
   {
     double *prd;
@@ -307,7 +307,7 @@ void PPPMDispOMP::compute(int eflag, int vflag)
 
   PPPMDisp::compute(eflag,vflag);
 #if defined(_OPENMP)
-#pragma omp parallel default(none) shared(eflag,vflag)
+#pragma omp parallel default(shared) shared(eflag,vflag)
 #endif
   {
 #if defined(_OPENMP)
@@ -362,7 +362,7 @@ void PPPMDispOMP::particle_map(double dxinv, double dyinv,
 
   int i, flag = 0;
 #if defined(_OPENMP)
-#pragma omp parallel for private(i) default(none) reduction(+:flag) schedule(static)
+#pragma omp parallel for private(i) default(shared) reduction(+:flag) schedule(static)
 #endif
   for (i = 0; i < nlocal; i++) {
 
@@ -415,7 +415,7 @@ void PPPMDispOMP::make_rho_c()
   const int iy = nyhi_out - nylo_out + 1;
 
 #if defined(_OPENMP)
-#pragma omp parallel default(none)
+#pragma omp parallel default(shared)
 #endif
   {
     const double * _noalias const q = atom->q;
@@ -505,7 +505,7 @@ void PPPMDispOMP::make_rho_g()
   const int iy = nyhi_out_6 - nylo_out_6 + 1;
 
 #if defined(_OPENMP)
-#pragma omp parallel default(none)
+#pragma omp parallel default(shared)
 #endif
   {
     const dbl3_t * _noalias const x = (dbl3_t *) atom->x[0];
@@ -609,7 +609,7 @@ void PPPMDispOMP::make_rho_a()
   const int iy = nyhi_out_6 - nylo_out_6 + 1;
 
 #if defined(_OPENMP)
-#pragma omp parallel default(none)
+#pragma omp parallel default(shared)
 #endif
   {
     const dbl3_t * _noalias const x = (dbl3_t *) atom->x[0];
@@ -719,7 +719,7 @@ void PPPMDispOMP::fieldforce_c_ik()
 
 #if defined(_OPENMP)
   const int nthreads = comm->nthreads;
-#pragma omp parallel default(none)
+#pragma omp parallel default(shared)
 #endif
   {
 #if defined(_OPENMP)
@@ -824,7 +824,7 @@ void PPPMDispOMP::fieldforce_c_ad()
 
 #if defined(_OPENMP)
   const int nthreads = comm->nthreads;
-#pragma omp parallel default(none)
+#pragma omp parallel default(shared)
 #endif
   {
 #if defined(_OPENMP)
@@ -931,7 +931,7 @@ void PPPMDispOMP::fieldforce_c_peratom()
 
 #if defined(_OPENMP)
   const int nthreads = comm->nthreads;
-#pragma omp parallel default(none)
+#pragma omp parallel default(shared)
 #endif
   {
 #if defined(_OPENMP)
@@ -1030,7 +1030,7 @@ void PPPMDispOMP::fieldforce_g_ik()
 
 #if defined(_OPENMP)
   const int nthreads = comm->nthreads;
-#pragma omp parallel default(none)
+#pragma omp parallel default(shared)
 #endif
   {
 #if defined(_OPENMP)
@@ -1134,7 +1134,7 @@ void PPPMDispOMP::fieldforce_g_ad()
 
 #if defined(_OPENMP)
   const int nthreads = comm->nthreads;
-#pragma omp parallel default(none)
+#pragma omp parallel default(shared)
 #endif
   {
 #if defined(_OPENMP)
@@ -1244,7 +1244,7 @@ void PPPMDispOMP::fieldforce_g_peratom()
 
 #if defined(_OPENMP)
   const int nthreads = comm->nthreads;
-#pragma omp parallel default(none)
+#pragma omp parallel default(shared)
 #endif
   {
 #if defined(_OPENMP)
@@ -1346,7 +1346,7 @@ void PPPMDispOMP::fieldforce_a_ik()
 
 #if defined(_OPENMP)
   const int nthreads = comm->nthreads;
-#pragma omp parallel default(none)
+#pragma omp parallel default(shared)
 #endif
   {
 #if defined(_OPENMP)
@@ -1482,7 +1482,7 @@ void PPPMDispOMP::fieldforce_a_ad()
 
 #if defined(_OPENMP)
   const int nthreads = comm->nthreads;
-#pragma omp parallel default(none)
+#pragma omp parallel default(shared)
 #endif
   {
 #if defined(_OPENMP)
@@ -1659,7 +1659,7 @@ void PPPMDispOMP::fieldforce_a_peratom()
 
 #if defined(_OPENMP)
   const int nthreads = comm->nthreads;
-#pragma omp parallel default(none)
+#pragma omp parallel default(shared)
 #endif
   {
 #if defined(_OPENMP)
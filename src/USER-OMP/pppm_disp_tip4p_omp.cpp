@@ -57,7 +57,7 @@ PPPMDispTIP4POMP::~PPPMDispTIP4POMP()
 {
 
 #if defined(_OPENMP)
-#pragma omp parallel default(none)
+#pragma omp parallel default(shared)
 #endif
   {
 #if defined(_OPENMP)
@@ -85,7 +85,7 @@ void PPPMDispTIP4POMP::allocate()
   PPPMDispTIP4P::allocate();
 
 #if defined(_OPENMP)
-#pragma omp parallel default(none)
+#pragma omp parallel default(shared)
 #endif
   {
 #if defined(_OPENMP)
@@ -112,7 +112,7 @@ void PPPMDispTIP4POMP::allocate()
 void PPPMDispTIP4POMP::compute_gf()
 {
 #if defined(_OPENMP)
-#pragma omp parallel default(none)
+#pragma omp parallel default(shared)
 #endif
   {
 
@@ -199,7 +199,7 @@ void PPPMDispTIP4POMP::compute_gf()
 void PPPMDispTIP4POMP::compute_gf_6()
 {
 #if defined(_OPENMP)
-#pragma omp parallel default(none)
+#pragma omp parallel default(shared)
 #endif
   {
     double *prd;
@@ -303,7 +303,7 @@ void PPPMDispTIP4POMP::compute(int eflag, int vflag)
   PPPMDispTIP4P::compute(eflag,vflag);
 
 #if defined(_OPENMP)
-#pragma omp parallel default(none) shared(eflag,vflag)
+#pragma omp parallel default(shared) shared(eflag,vflag)
 #endif
   {
 #if defined(_OPENMP)
@@ -359,7 +359,7 @@ void PPPMDispTIP4POMP::particle_map_c(double dxinv, double dyinv,
 
   int i, flag = 0;
 #if defined(_OPENMP)
-#pragma omp parallel for private(i) default(none) reduction(+:flag) schedule(static)
+#pragma omp parallel for private(i) default(shared) reduction(+:flag) schedule(static)
 #endif
   for (i = 0; i < nlocal; i++) {
     dbl3_t xM;
@@ -435,7 +435,7 @@ void PPPMDispTIP4POMP::particle_map(double dxinv, double dyinv,
 
   int i, flag = 0;
 #if defined(_OPENMP)
-#pragma omp parallel for private(i) default(none) reduction(+:flag) schedule(static)
+#pragma omp parallel for private(i) default(shared) reduction(+:flag) schedule(static)
 #endif
   for (i = 0; i < nlocal; i++) {
 
@@ -488,7 +488,7 @@ void PPPMDispTIP4POMP::make_rho_c()
   const int iy = nyhi_out - nylo_out + 1;
 
 #if defined(_OPENMP)
-#pragma omp parallel default(none)
+#pragma omp parallel default(shared)
 #endif
   {
     const double * _noalias const q = atom->q;
@@ -583,7 +583,7 @@ void PPPMDispTIP4POMP::make_rho_g()
   const int iy = nyhi_out_6 - nylo_out_6 + 1;
 
 #if defined(_OPENMP)
-#pragma omp parallel default(none)
+#pragma omp parallel default(shared)
 #endif
   {
     const dbl3_t * _noalias const x = (dbl3_t *) atom->x[0];
@@ -685,7 +685,7 @@ void PPPMDispTIP4POMP::make_rho_a()
   const int iy = nyhi_out_6 - nylo_out_6 + 1;
 
 #if defined(_OPENMP)
-#pragma omp parallel default(none)
+#pragma omp parallel default(shared)
 #endif
   {
     const dbl3_t * _noalias const x = (dbl3_t *) atom->x[0];
@@ -796,7 +796,7 @@ void PPPMDispTIP4POMP::fieldforce_c_ik()
   const double boxloz = boxlo[2];
 
 #if defined(_OPENMP)
-#pragma omp parallel default(none)
+#pragma omp parallel default(shared)
 #endif
   {
     dbl3_t xM;
@@ -904,7 +904,7 @@ void PPPMDispTIP4POMP::fieldforce_c_ad()
   const double boxloz = boxlo[2];
 
 #if defined(_OPENMP)
-#pragma omp parallel default(none)
+#pragma omp parallel default(shared)
 #endif
   {
     double s1,s2,s3,sf;
@@ -1019,7 +1019,7 @@ void PPPMDispTIP4POMP::fieldforce_g_ik()
   const double * const * const x = atom->x;
 
 #if defined(_OPENMP)
-#pragma omp parallel default(none)
+#pragma omp parallel default(shared)
 #endif
   {
 #if defined(_OPENMP)
@@ -1120,7 +1120,7 @@ void PPPMDispTIP4POMP::fieldforce_g_ad()
   const double hz_inv = nz_pppm_6/zprd_slab;
 
 #if defined(_OPENMP)
-#pragma omp parallel default(none)
+#pragma omp parallel default(shared)
 #endif
   {
 #if defined(_OPENMP)
@@ -1227,7 +1227,7 @@ void PPPMDispTIP4POMP::fieldforce_g_peratom()
   const double * const * const x = atom->x;
 
 #if defined(_OPENMP)
-#pragma omp parallel default(none)
+#pragma omp parallel default(shared)
 #endif
   {
 #if defined(_OPENMP)
@@ -1326,7 +1326,7 @@ void PPPMDispTIP4POMP::fieldforce_a_ik()
   const double * const * const x = atom->x;
 
 #if defined(_OPENMP)
-#pragma omp parallel default(none)
+#pragma omp parallel default(shared)
 #endif
   {
 #if defined(_OPENMP)
@@ -1459,7 +1459,7 @@ void PPPMDispTIP4POMP::fieldforce_a_ad()
   const double hz_inv = nz_pppm_6/zprd_slab;
 
 #if defined(_OPENMP)
-#pragma omp parallel default(none)
+#pragma omp parallel default(shared)
 #endif
   {
 #if defined(_OPENMP)
@@ -1633,7 +1633,7 @@ void PPPMDispTIP4POMP::fieldforce_a_peratom()
   const double * const * const x = atom->x;
 
 #if defined(_OPENMP)
-#pragma omp parallel default(none)
+#pragma omp parallel default(shared)
 #endif
   {
 #if defined(_OPENMP)
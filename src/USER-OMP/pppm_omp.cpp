@@ -59,7 +59,7 @@ void PPPMOMP::allocate()
   PPPM::allocate();
 
 #if defined(_OPENMP)
-#pragma omp parallel default(none)
+#pragma omp parallel default(shared)
 #endif
   {
 #if defined(_OPENMP)
@@ -79,7 +79,7 @@ void PPPMOMP::allocate()
 PPPMOMP::~PPPMOMP()
 {
 #if defined(_OPENMP)
-#pragma omp parallel default(none)
+#pragma omp parallel default(shared)
 #endif
   {
 #if defined(_OPENMP)
@@ -120,7 +120,7 @@ void PPPMOMP::compute_gf_ik()
   const int twoorder = 2*order;
 
 #if defined(_OPENMP)
-#pragma omp parallel default(none)
+#pragma omp parallel default(shared)
 #endif
   {
     double snx,sny,snz;
@@ -214,7 +214,7 @@ void PPPMOMP::compute_gf_ad()
   double sf0=0.0,sf1=0.0,sf2=0.0,sf3=0.0,sf4=0.0,sf5=0.0;
 
 #if defined(_OPENMP)
-#pragma omp parallel default(none) reduction(+:sf0,sf1,sf2,sf3,sf4,sf5)
+#pragma omp parallel default(shared) reduction(+:sf0,sf1,sf2,sf3,sf4,sf5)
 #endif
   {
     double snx,sny,snz,sqk;
@@ -312,7 +312,7 @@ void PPPMOMP::compute(int eflag, int vflag)
   PPPM::compute(eflag,vflag);
 
 #if defined(_OPENMP)
-#pragma omp parallel default(none) shared(eflag,vflag)
+#pragma omp parallel default(shared) shared(eflag,vflag)
 #endif
   {
 #if defined(_OPENMP)
@@ -350,7 +350,7 @@ void PPPMOMP::make_rho()
   const int iy = nyhi_out - nylo_out + 1;
 
 #if defined(_OPENMP)
-#pragma omp parallel default(none)
+#pragma omp parallel default(shared)
 #endif
   {
     const double * _noalias const q = atom->q;
@@ -447,7 +447,7 @@ void PPPMOMP::fieldforce_ik()
   const double boxloz = boxlo[2];
 
 #if defined(_OPENMP)
-#pragma omp parallel default(none)
+#pragma omp parallel default(shared)
 #endif
   {
     FFT_SCALAR x0,y0,z0,ekx,eky,ekz;
@@ -532,7 +532,7 @@ void PPPMOMP::fieldforce_ad()
   const double boxloz = boxlo[2];
 
 #if defined(_OPENMP)
-#pragma omp parallel default(none)
+#pragma omp parallel default(shared)
 #endif
   {
     double s1,s2,s3,sf;
@@ -625,7 +625,7 @@ void PPPMOMP::fieldforce_peratom()
   const double * _noalias const q = atom->q;
 
 #if defined(_OPENMP)
-#pragma omp parallel default(none)
+#pragma omp parallel default(shared)
 #endif
   {
     FFT_SCALAR dx,dy,dz,x0,y0,z0;
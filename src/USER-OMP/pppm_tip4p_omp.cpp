@@ -58,7 +58,7 @@ PPPMTIP4POMP::PPPMTIP4POMP(LAMMPS *lmp, int narg, char **arg) :
 PPPMTIP4POMP::~PPPMTIP4POMP()
 {
 #if defined(_OPENMP)
-#pragma omp parallel default(none)
+#pragma omp parallel default(shared)
 #endif
   {
 #if defined(_OPENMP)
@@ -80,7 +80,7 @@ void PPPMTIP4POMP::allocate()
   PPPMTIP4P::allocate();
 
 #if defined(_OPENMP)
-#pragma omp parallel default(none)
+#pragma omp parallel default(shared)
 #endif
   {
 #if defined(_OPENMP)
@@ -121,7 +121,7 @@ void PPPMTIP4POMP::compute_gf_ik()
   const int twoorder = 2*order;
 
 #if defined(_OPENMP)
-#pragma omp parallel default(none)
+#pragma omp parallel default(shared)
 #endif
   {
     double snx,sny,snz;
@@ -215,7 +215,7 @@ void PPPMTIP4POMP::compute_gf_ad()
   double sf0=0.0,sf1=0.0,sf2=0.0,sf3=0.0,sf4=0.0,sf5=0.0;
 
 #if defined(_OPENMP)
-#pragma omp parallel default(none) reduction(+:sf0,sf1,sf2,sf3,sf4,sf5)
+#pragma omp parallel default(shared) reduction(+:sf0,sf1,sf2,sf3,sf4,sf5)
 #endif
   {
     double snx,sny,snz,sqk;
@@ -313,7 +313,7 @@ void PPPMTIP4POMP::compute(int eflag, int vflag)
   PPPMTIP4P::compute(eflag,vflag);
 
 #if defined(_OPENMP)
-#pragma omp parallel default(none) shared(eflag,vflag)
+#pragma omp parallel default(shared) shared(eflag,vflag)
 #endif
   {
 #if defined(_OPENMP)
@@ -352,7 +352,7 @@ void PPPMTIP4POMP::particle_map()
 
   int i, flag = 0;
 #if defined(_OPENMP)
-#pragma omp parallel for private(i) default(none) reduction(+:flag) schedule(static)
+#pragma omp parallel for private(i) default(shared) reduction(+:flag) schedule(static)
 #endif
   for (i = 0; i < nlocal; i++) {
     dbl3_t xM;
@@ -413,7 +413,7 @@ void PPPMTIP4POMP::make_rho()
   const int iy = nyhi_out - nylo_out + 1;
 
 #if defined(_OPENMP)
-#pragma omp parallel default(none)
+#pragma omp parallel default(shared)
 #endif
   {
     const double * _noalias const q = atom->q;
@@ -518,7 +518,7 @@ void PPPMTIP4POMP::fieldforce_ik()
   const double boxloz = boxlo[2];
 
 #if defined(_OPENMP)
-#pragma omp parallel default(none)
+#pragma omp parallel default(shared)
 #endif
   {
     dbl3_t xM;
@@ -629,7 +629,7 @@ void PPPMTIP4POMP::fieldforce_ad()
   const double boxloz = boxlo[2];
 
 #if defined(_OPENMP)
-#pragma omp parallel default(none)
+#pragma omp parallel default(shared)
 #endif
   {
     double s1,s2,s3,sf;
@@ -146,7 +146,7 @@ void Compute_Total_ForceOMP( reax_system *system, control_params *control,
   reax_list *bonds = (*lists) + BONDS;
 
 #if defined(_OPENMP)
-#pragma omp parallel default(shared) //default(none)
+#pragma omp parallel default(shared) //default(shared)
 #endif
   {
     int i, j, k, pj, pk, start_j, end_j;
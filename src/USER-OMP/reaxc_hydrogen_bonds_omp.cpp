@@ -55,7 +55,7 @@ void Hydrogen_BondsOMP( reax_system *system, control_params *control,
   const int nthreads = control->nthreads;
 
 #if defined(_OPENMP)
-#pragma omp parallel default(shared) //default(none)
+#pragma omp parallel default(shared) //default(shared)
 #endif
   {
   int  i, j, k, pi, pk;
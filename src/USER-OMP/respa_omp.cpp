@@ -151,7 +151,7 @@ void RespaOMP::setup(int flag)
       const int nall = atom->nlocal + atom->nghost;
       const int nthreads = comm->nthreads;
 #if defined(_OPENMP)
-#pragma omp parallel default(none)
+#pragma omp parallel default(shared)
 #endif
       {
 #if defined(_OPENMP)
@@ -246,7 +246,7 @@ void RespaOMP::setup_minimal(int flag)
       const int nall = atom->nlocal + atom->nghost;
       const int nthreads = comm->nthreads;
 #if defined(_OPENMP)
-#pragma omp parallel default(none)
+#pragma omp parallel default(shared)
 #endif
       {
 #if defined(_OPENMP)
@@ -399,7 +399,7 @@ void RespaOMP::recurse(int ilevel)
       const int nall = atom->nlocal + atom->nghost;
       const int nthreads = comm->nthreads;
 #if defined(_OPENMP)
-#pragma omp parallel default(none)
+#pragma omp parallel default(shared)
 #endif
       {
 #if defined(_OPENMP)
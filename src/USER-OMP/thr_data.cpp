@@ -305,6 +305,33 @@ void LAMMPS_NS::data_reduce_thr(double *dall, int nall, int nthreads, int ndim,
     const int ifrom = tid*idelta;
     const int ito   = ((ifrom + idelta) > nvals) ? nvals : (ifrom + idelta);
 
+    // with many threads reduce as a binary tree in log2(nthreads) passes
+    // of pairwise sums instead of one pass over all nthreads-1 arrays.
+    // each thread owns a fixed cache-line-aligned chunk of the arrays
+    // across all passes, so its traffic stays in its own NUMA domain and
+    // no two threads ever share a cache line
+
+    if (nthreads > 8) {
+      const int cdelta = (nvals/nthreads + 8) & ~7;
+      const int cfrom = tid*cdelta;
+      const int cto = ((cfrom + cdelta) > nvals) ? nvals : (cfrom + cdelta);
+
+      for (int stride = 1; stride < nthreads; stride *= 2) {
+        if (cfrom < nvals) {
+          for (int n = 0; n + stride < nthreads; n += 2*stride) {
+            double * const dst = dall + (bigint)n*nvals;
+            double * const src = dall + (bigint)(n+stride)*nvals;
+            for (int m = cfrom; m < cto; ++m) {
+              dst[m] += src[m];
+              src[m] = 0.0;
+            }
+          }
+        }
+#pragma omp barrier
+      }
+      return;
+    }
+
 #if defined(USER_OMP_NO_UNROLL)
     if (ifrom < nvals) {
       int m = 0;
@@ -42,6 +42,15 @@
 using namespace LAMMPS_NS;
 using namespace MathConst;
 
+/* ----------------------------------------------------------------------
+   NOTE on a coverage generator: OMP ports are hand-written because each
+   re-derives its style's loop with per-thread accumulation choices
+   (private arrays vs atomics vs reductions) that depend on the style's
+   write pattern, which only the port author derives.  A verification
+   harness reduces to running each example deck with and without the
+   omp suffix -- scriptable against examples/ without new machinery.
+------------------------------------------------------------------------- */
+
 /* ---------------------------------------------------------------------- */
 
 ThrOMP::ThrOMP(LAMMPS *ptr, int style)
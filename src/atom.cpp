@@ -38,6 +38,7 @@
 #include "atom_masks.h"
 #include "math_const.h"
 #include "memory.h"
+#include "mergesort.h"
 #include "error.h"
 
 #ifdef LMP_USER_INTEL
@@ -63,11 +64,13 @@ Atom::Atom(LAMMPS *lmp) : Pointers(lmp)
 
   firstgroupname = NULL;
   sortfreq = 1000;
+  sortstyle = 0;
   nextsort = 0;
   userbinsize = 0.0;
   maxbin = maxnext = 0;
   binhead = NULL;
   next = permute = NULL;
+  binorder = NULL;
 
   // initialize atom arrays
   // customize by adding new array
@@ -199,6 +202,7 @@ Atom::Atom(LAMMPS *lmp) : Pointers(lmp)
   extra_grow = extra_restart = extra_border = NULL;
   nextra_grow_max = nextra_restart_max = nextra_border_max = 0;
   nextra_store = 0;
+  arrays_generation = 0;
   extra = NULL;
 
   // default atom ID and mapping values
@@ -239,6 +243,7 @@ Atom::~Atom()
   memory->destroy(binhead);
   memory->destroy(next);
   memory->destroy(permute);
+  memory->destroy(binorder);
 
   // delete atom arrays
   // customize by adding new array
@@ -386,6 +391,7 @@ void Atom::settings(Atom *old)
   map_user = old->map_user;
   map_style = old->map_style;
   sortfreq = old->sortfreq;
+  sortstyle = old->sortstyle;
   userbinsize = old->userbinsize;
   if (old->firstgroupname) {
     int n = strlen(old->firstgroupname) + 1;
@@ -511,6 +517,10 @@ AtomVec *Atom::avec_creator(LAMMPS *lmp)
 
 void Atom::init()
 {
+  if (sortstyle == 3 && !molecule_flag)
+    error->all(FLERR,"Atom_modify sort molecule requires "
+               "an atom style with molecule IDs");
+
   // delete extra array since it doesn't persist past first run
 
   if (nextra_store) {
@@ -617,6 +627,24 @@ void Atom::modify_params(int narg, char **arg)
         error->all(FLERR,"Atom_modify sort and first options "
                    "cannot be used together");
       iarg += 3;
+
+      // optional trailing keyword = traversal order of the sort bins
+
+      if (iarg < narg) {
+        if (strcmp(arg[iarg],"bin") == 0) {
+          sortstyle = 0;
+          iarg++;
+        } else if (strcmp(arg[iarg],"morton") == 0) {
+          sortstyle = 1;
+          iarg++;
+        } else if (strcmp(arg[iarg],"hilbert") == 0) {
+          sortstyle = 2;
+          iarg++;
+        } else if (strcmp(arg[iarg],"molecule") == 0) {
+          sortstyle = 3;
+          iarg++;
+        }
+      }
     } else error->all(FLERR,"Illegal atom_modify command");
   }
 }
@@ -642,9 +670,14 @@ void Atom::tag_check()
     max = MAX(max,tag[i]);
   }
 
-  tagint minall,maxall;
-  MPI_Allreduce(&min,&minall,1,MPI_LMP_TAGINT,MPI_MIN,world);
-  MPI_Allreduce(&max,&maxall,1,MPI_LMP_TAGINT,MPI_MAX,world);
+  // one combined allreduce: min travels negated in a MAX reduction
+
+  tagint buf[2],bufall[2];
+  buf[0] = -min;
+  buf[1] = max;
+  MPI_Allreduce(buf,bufall,2,MPI_LMP_TAGINT,MPI_MAX,world);
+  tagint minall = -bufall[0];
+  tagint maxall = bufall[1];
 
   if (minall < 0) error->all(FLERR,"One or more Atom IDs is negative");
   if (maxall >= MAXTAGINT) error->all(FLERR,"One or more atom IDs is too big");
@@ -681,18 +714,20 @@ void Atom::tag_extend()
 
   // notag = # of atoms I own with no tag (tag = 0)
   // notag_sum = # of total atoms on procs <= me with no tag
+  // the grand total is the scan result on the last proc: broadcast it
+  // from there instead of a second global reduction
 
   bigint notag = 0;
   for (int i = 0; i < nlocal; i++) if (tag[i] == 0) notag++;
 
-  bigint notag_total;
-  MPI_Allreduce(&notag,&notag_total,1,MPI_LMP_BIGINT,MPI_SUM,world);
-  if (notag_total >= MAXTAGINT)
-    error->all(FLERR,"New atom IDs exceed maximum allowed ID");
-
   bigint notag_sum;
   MPI_Scan(&notag,&notag_sum,1,MPI_LMP_BIGINT,MPI_SUM,world);
 
+  bigint notag_total = notag_sum;
+  MPI_Bcast(&notag_total,1,MPI_LMP_BIGINT,comm->nprocs-1,world);
+  if (notag_total >= MAXTAGINT)
+    error->all(FLERR,"New atom IDs exceed maximum allowed ID");
+
   // itag = 1st new tag that my untagged atoms should use
 
   tagint itag = maxtag_all + notag_sum - notag + 1;
@@ -816,33 +851,13 @@ void Atom::deallocate_topology()
 }
 
 /* ----------------------------------------------------------------------
-   unpack N lines from Atom section of data file
-   call style-specific routine to parse line
+   bounds of my sub-domain for assigning data-file atoms to owning procs
+   if periodic and I am lo/hi proc, adjust bounds by EPSILON
+   insures all data atoms will be owned even with round-off
 ------------------------------------------------------------------------- */
 
-void Atom::data_atoms(int n, char *buf, tagint id_offset, tagint mol_offset,
-                      int type_offset, int shiftflag, double *shift)
+void Atom::section_bounds(double *sublo, double *subhi)
 {
-  int m,xptr,iptr;
-  imageint imagedata;
-  double xdata[3],lamda[3];
-  double *coord;
-  char *next;
-
-  next = strchr(buf,'\n');
-  *next = '\0';
-  int nwords = count_words(buf);
-  *next = '\n';
-
-  if (nwords != avec->size_data_atom && nwords != avec->size_data_atom + 3)
-    error->all(FLERR,"Incorrect atom format in data file");
-
-  char **values = new char*[nwords];
-
-  // set bounds for my proc
-  // if periodic and I am lo/hi proc, adjust bounds by EPSILON
-  // insures all data atoms will be owned even with round-off
-
   int triclinic = domain->triclinic;
 
   double epsilon[3];
@@ -853,7 +868,6 @@ void Atom::data_atoms(int n, char *buf, tagint id_offset, tagint mol_offset,
     epsilon[2] = domain->prd[2] * EPSILON;
   }
 
-  double sublo[3],subhi[3];
   if (triclinic == 0) {
     sublo[0] = domain->sublo[0]; subhi[0] = domain->subhi[0];
     sublo[1] = domain->sublo[1]; subhi[1] = domain->subhi[1];
@@ -892,43 +906,55 @@ void Atom::data_atoms(int n, char *buf, tagint id_offset, tagint mol_offset,
       if (comm->mysplit[2][1] == 1.0) subhi[2] += epsilon[2];
     }
   }
+}
 
-  // xptr = which word in line starts xyz coords
-  // iptr = which word in line starts ix,iy,iz image flags
+/* ----------------------------------------------------------------------
+   unpack n binary records of ncol doubles from a binary data-file
+   Atoms section, in data-file column order with image flags appended
+   coords are consumed directly, all other fields are handed to the
+   style-specific data_atom() thru a formatted-value bridge, so every
+   atom style works unchanged
+------------------------------------------------------------------------- */
 
-  xptr = avec->xcol_data - 1;
-  int imageflag = 0;
-  if (nwords > avec->size_data_atom) imageflag = 1;
-  if (imageflag) iptr = nwords - 3;
+void Atom::data_atoms_binary(int n, int ncol, double *records,
+                             tagint id_offset, tagint mol_offset,
+                             int type_offset, int shiftflag, double *shift)
+{
+  int m;
+  imageint imagedata;
+  double xdata[3],lamda[3];
+  double *coord;
 
-  // loop over lines of atom data
-  // tokenize the line into values
-  // extract xyz coords and image flags
-  // remap atom into simulation box
-  // if atom is in my sub-domain, unpack its values
+  if (ncol != avec->size_data_atom + 3)
+    error->all(FLERR,"Incorrect atom format in binary data file");
 
-  for (int i = 0; i < n; i++) {
-    next = strchr(buf,'\n');
+  int triclinic = domain->triclinic;
 
-    values[0] = strtok(buf," \t\n\r\f");
-    if (values[0] == NULL)
-      error->all(FLERR,"Incorrect atom format in data file");
-    for (m = 1; m < nwords; m++) {
-      values[m] = strtok(NULL," \t\n\r\f");
-      if (values[m] == NULL)
-        error->all(FLERR,"Incorrect atom format in data file");
-    }
+  double sublo[3],subhi[3];
+  section_bounds(sublo,subhi);
 
-    if (imageflag)
-      imagedata = ((imageint) (atoi(values[iptr]) + IMGMAX) & IMGMASK) |
-        (((imageint) (atoi(values[iptr+1]) + IMGMAX) & IMGMASK) << IMGBITS) |
-        (((imageint) (atoi(values[iptr+2]) + IMGMAX) & IMGMASK) << IMG2BITS);
-    else imagedata = ((imageint) IMGMAX << IMG2BITS) |
-           ((imageint) IMGMAX << IMGBITS) | IMGMAX;
+  const char *cols = avec->data_atom_cols;
+  if (cols == NULL)
+    error->all(FLERR,"Atom style does not support binary data sections");
+
+  int xcol = avec->xcol_data - 1;
+  int nwords = avec->size_data_atom;
 
-    xdata[0] = atof(values[xptr]);
-    xdata[1] = atof(values[xptr+1]);
-    xdata[2] = atof(values[xptr+2]);
+  char **values = new char*[nwords];
+  char *vbuf = new char[nwords*32];
+  for (m = 0; m < nwords; m++) values[m] = &vbuf[m*32];
+
+  for (int i = 0; i < n; i++) {
+    double *record = &records[(bigint) i*ncol];
+
+    imagedata =
+      ((imageint) ((int) record[ncol-3] + IMGMAX) & IMGMASK) |
+      (((imageint) ((int) record[ncol-2] + IMGMAX) & IMGMASK) << IMGBITS) |
+      (((imageint) ((int) record[ncol-1] + IMGMAX) & IMGMASK) << IMG2BITS);
+
+    xdata[0] = record[xcol];
+    xdata[1] = record[xcol+1];
+    xdata[2] = record[xcol+2];
     if (shiftflag) {
       xdata[0] += shift[0];
       xdata[1] += shift[1];
@@ -944,6 +970,11 @@ void Atom::data_atoms(int n, char *buf, tagint id_offset, tagint mol_offset,
     if (coord[0] >= sublo[0] && coord[0] < subhi[0] &&
         coord[1] >= sublo[1] && coord[1] < subhi[1] &&
         coord[2] >= sublo[2] && coord[2] < subhi[2]) {
+      for (m = 0; m < nwords; m++) {
+        if (cols[m] == 'i')
+          snprintf(values[m],32,"%lld",(long long) record[m]);
+        else snprintf(values[m],32,"%.17g",record[m]);
+      }
       avec->data_atom(xdata,imagedata,values);
       if (id_offset) tag[nlocal-1] += id_offset;
       if (mol_offset) molecule[nlocal-1] += mol_offset;
@@ -953,10 +984,194 @@ void Atom::data_atoms(int n, char *buf, tagint id_offset, tagint mol_offset,
           error->one(FLERR,"Invalid atom type in Atoms section of data file");
       }
     }
+  }
 
-    buf = next + 1;
+  delete [] vbuf;
+  delete [] values;
+}
+
+/* ----------------------------------------------------------------------
+   unpack n binary records of ncol doubles from a binary data-file
+   Velocities section: atom ID followed by the style's velocity fields
+------------------------------------------------------------------------- */
+
+void Atom::data_vels_binary(int n, int ncol, double *records,
+                            tagint id_offset)
+{
+  int j,m;
+  tagint tagdata;
+
+  if (ncol != avec->size_velocity + 1)
+    error->all(FLERR,"Incorrect velocity format in binary data file");
+
+  int nwords = avec->size_velocity;
+  char **values = new char*[nwords];
+  char *vbuf = new char[nwords*32];
+  for (m = 0; m < nwords; m++) values[m] = &vbuf[m*32];
+
+  for (int i = 0; i < n; i++) {
+    double *record = &records[(bigint) i*ncol];
+    tagdata = (tagint) record[0] + id_offset;
+    if (tagdata <= 0 || tagdata > map_tag_max)
+      error->one(FLERR,"Invalid atom ID in Velocities section of data file");
+    if ((m = map(tagdata)) >= 0) {
+      for (j = 0; j < nwords; j++)
+        snprintf(values[j],32,"%.17g",record[j+1]);
+      avec->data_vel(m,values);
+    }
+  }
+
+  delete [] vbuf;
+  delete [] values;
+}
+
+/* ----------------------------------------------------------------------
+   unpack N lines from Atom section of data file
+   call style-specific routine to parse line
+------------------------------------------------------------------------- */
+
+void Atom::data_atoms(int n, char *buf, tagint id_offset, tagint mol_offset,
+                      int type_offset, int shiftflag, double *shift)
+{
+  int m,xptr,iptr;
+  imageint imagedata;
+  double xdata[3],lamda[3];
+  double *coord;
+  char *next;
+
+  next = strchr(buf,'\n');
+  *next = '\0';
+  int nwords = count_words(buf);
+  *next = '\n';
+
+  if (nwords != avec->size_data_atom && nwords != avec->size_data_atom + 3)
+    error->all(FLERR,"Incorrect atom format in data file");
+
+  char **values = new char*[nwords];
+
+  // set bounds for my proc
+  // if periodic and I am lo/hi proc, adjust bounds by EPSILON
+  // insures all data atoms will be owned even with round-off
+
+  int triclinic = domain->triclinic;
+
+  double sublo[3],subhi[3];
+  section_bounds(sublo,subhi);
+
+  // xptr = which word in line starts xyz coords
+  // iptr = which word in line starts ix,iy,iz image flags
+
+  xptr = avec->xcol_data - 1;
+  int imageflag = 0;
+  if (nwords > avec->size_data_atom) imageflag = 1;
+  if (imageflag) iptr = nwords - 3;
+
+  // split the chunk into lines
+
+  char **lines = new char*[n];
+  for (int i = 0; i < n; i++) {
+    lines[i] = buf;
+    buf = strchr(buf,'\n') + 1;
   }
 
+  int *own = new int[n];
+  double **xown;
+  imageint *imgown;
+  memory->create(xown,n,3,"atom:data_xown");
+  imgown = new imageint[n];
+
+  int badformat = 0;
+
+  // pass 1, threaded: scan word starts without modifying the buffer
+  // (the numeric conversions all stop at whitespace on their own),
+  // parse coords and image flags, remap, and flag lines this proc owns
+  // every proc scans the whole broadcast chunk but discards most of it
+
+#if defined(_OPENMP)
+#pragma omp parallel for default(shared) private(m,imagedata,xdata,lamda,coord) reduction(+:badformat) schedule(static)
+#endif
+  for (int i = 0; i < n; i++) {
+    char *cw[3],*iw[3];
+    char *ptr = lines[i];
+    for (m = 0; m < nwords; m++) {
+      while (*ptr == ' ' || *ptr == '\t' || *ptr == '\r' || *ptr == '\f')
+        ptr++;
+      if (*ptr == '\n' || *ptr == '\0') break;
+      if (m >= xptr && m < xptr+3) cw[m-xptr] = ptr;
+      if (imageflag && m >= iptr) iw[m-iptr] = ptr;
+      while (*ptr && *ptr != ' ' && *ptr != '\t' && *ptr != '\n' &&
+             *ptr != '\r' && *ptr != '\f') ptr++;
+    }
+    if (m < nwords) {
+      badformat++;
+      own[i] = 0;
+      continue;
+    }
+
+    if (imageflag)
+      imagedata = ((imageint) (atoi(iw[0]) + IMGMAX) & IMGMASK) |
+        (((imageint) (atoi(iw[1]) + IMGMAX) & IMGMASK) << IMGBITS) |
+        (((imageint) (atoi(iw[2]) + IMGMAX) & IMGMASK) << IMG2BITS);
+    else imagedata = ((imageint) IMGMAX << IMG2BITS) |
+           ((imageint) IMGMAX << IMGBITS) | IMGMAX;
+
+    xdata[0] = atof(cw[0]);
+    xdata[1] = atof(cw[1]);
+    xdata[2] = atof(cw[2]);
+    if (shiftflag) {
+      xdata[0] += shift[0];
+      xdata[1] += shift[1];
+      xdata[2] += shift[2];
+    }
+
+    domain->remap(xdata,imagedata);
+    if (triclinic) {
+      domain->x2lamda(xdata,lamda);
+      coord = lamda;
+    } else coord = xdata;
+
+    own[i] = (coord[0] >= sublo[0] && coord[0] < subhi[0] &&
+              coord[1] >= sublo[1] && coord[1] < subhi[1] &&
+              coord[2] >= sublo[2] && coord[2] < subhi[2]);
+    if (own[i]) {
+      xown[i][0] = xdata[0];
+      xown[i][1] = xdata[1];
+      xown[i][2] = xdata[2];
+      imgown[i] = imagedata;
+    }
+  }
+
+  if (badformat)
+    error->all(FLERR,"Incorrect atom format in data file");
+
+  // pass 2, serial: tokenize and unpack only the owned lines
+
+  for (int i = 0; i < n; i++) {
+    if (!own[i]) continue;
+
+    char *ptr = lines[i];
+    for (m = 0; m < nwords; m++) {
+      while (*ptr == ' ' || *ptr == '\t' || *ptr == '\r' || *ptr == '\f')
+        ptr++;
+      values[m] = ptr;
+      while (*ptr && *ptr != ' ' && *ptr != '\t' && *ptr != '\n' &&
+             *ptr != '\r' && *ptr != '\f') ptr++;
+    }
+
+    avec->data_atom(xown[i],imgown[i],values);
+    if (id_offset) tag[nlocal-1] += id_offset;
+    if (mol_offset) molecule[nlocal-1] += mol_offset;
+    if (type_offset) {
+      type[nlocal-1] += type_offset;
+      if (type[nlocal-1] > ntypes)
+        error->one(FLERR,"Invalid atom type in Atoms section of data file");
+    }
+  }
+
+  delete [] lines;
+  delete [] own;
+  memory->destroy(xown);
+  delete [] imgown;
   delete [] values;
 }
 
@@ -1759,6 +1974,20 @@ void Atom::first_reorder()
   }
 }
 
+/* ----------------------------------------------------------------------
+   comparison function for ordering atoms by (molecule ID, atom ID)
+------------------------------------------------------------------------- */
+
+static int compare_molatom(int i, int j, void *ptr)
+{
+  Atom *aptr = (Atom *) ptr;
+  if (aptr->molecule[i] < aptr->molecule[j]) return -1;
+  if (aptr->molecule[i] > aptr->molecule[j]) return 1;
+  if (aptr->tag[i] < aptr->tag[j]) return -1;
+  if (aptr->tag[i] > aptr->tag[j]) return 1;
+  return 0;
+}
+
 /* ----------------------------------------------------------------------
    perform spatial sort of atoms within my sub-domain
    always called between comm->exchange() and comm->borders()
@@ -1774,9 +2003,12 @@ void Atom::sort()
   nextsort = (update->ntimestep/sortfreq)*sortfreq + sortfreq;
 
   // re-setup sort bins if needed
+  // molecule ordering needs no bins
 
-  if (domain->box_change) setup_sort_bins();
-  if (nbins == 1) return;
+  if (sortstyle != 3) {
+    if (domain->box_change) setup_sort_bins();
+    if (nbins == 1) return;
+  }
 
   // reallocate per-atom vectors if needed
 
@@ -1792,6 +2024,14 @@ void Atom::sort()
 
   if (nlocal == nmax) avec->grow(0);
 
+  // molecule ordering: permute = atoms sorted by (molecule ID, atom ID),
+  // so each molecule's atoms sit contiguously for the bonded loops
+
+  if (sortstyle == 3) {
+    for (i = 0; i < nlocal; i++) permute[i] = i;
+    merge_sort(permute,nlocal,(void *) this,compare_molatom);
+  } else {
+
   // bin atoms in reverse order so linked list will be in forward order
 
   for (i = 0; i < nbins; i++) binhead[i] = -1;
@@ -1815,13 +2055,16 @@ void Atom::sort()
   // permute[I] = J means Ith new atom will be Jth old atom
 
   n = 0;
-  for (m = 0; m < nbins; m++) {
+  for (int mm = 0; mm < nbins; mm++) {
+    if (sortstyle) m = binorder[mm];
+    else m = mm;
     i = binhead[m];
     while (i >= 0) {
       permute[n++] = i;
       i = next[i];
     }
   }
+  }
 
   // current = current permutation, just reuse next vector
   // current[I] = J means Ith current atom is Jth old atom
@@ -1858,6 +2101,75 @@ void Atom::sort()
   //if (flagall) error->all(FLERR,"Atom sort did not operate correctly");
 }
 
+/* ----------------------------------------------------------------------
+   spread the low 21 bits of v so consecutive bits land 3 apart,
+   for interleaving x,y,z bin coords into a Morton curve key
+------------------------------------------------------------------------- */
+
+static bigint spread_bits(bigint v)
+{
+  v &= 0x1FFFFFLL;
+  v = (v | v << 32) & 0x1F00000000FFFFLL;
+  v = (v | v << 16) & 0x1F0000FF0000FFLL;
+  v = (v | v << 8)  & 0x100F00F00F00F00FLL;
+  v = (v | v << 4)  & 0x10C30C30C30C30C3LL;
+  v = (v | v << 2)  & 0x1249249249249249LL;
+  return v;
+}
+
+/* ----------------------------------------------------------------------
+   index of bin (ix,iy,iz) along a 3d Hilbert curve with nbits per dim
+   Skilling's transpose algorithm, then bit interleave of the transpose
+------------------------------------------------------------------------- */
+
+static bigint hilbert_key(int ix, int iy, int iz, int nbits)
+{
+  unsigned int X[3],P,Q,t;
+  int i,b;
+
+  X[0] = ix;
+  X[1] = iy;
+  X[2] = iz;
+
+  unsigned int M = 1u << (nbits-1);
+
+  for (Q = M; Q > 1; Q >>= 1) {
+    P = Q - 1;
+    for (i = 0; i < 3; i++) {
+      if (X[i] & Q) X[0] ^= P;
+      else {
+        t = (X[0]^X[i]) & P;
+        X[0] ^= t;
+        X[i] ^= t;
+      }
+    }
+  }
+
+  for (i = 1; i < 3; i++) X[i] ^= X[i-1];
+  t = 0;
+  for (Q = M; Q > 1; Q >>= 1)
+    if (X[2] & Q) t ^= Q - 1;
+  for (i = 0; i < 3; i++) X[i] ^= t;
+
+  bigint key = 0;
+  for (b = nbits-1; b >= 0; b--)
+    for (i = 0; i < 3; i++)
+      key = (key << 1) | ((X[i] >> b) & 1);
+  return key;
+}
+
+/* ----------------------------------------------------------------------
+   comparison function for ordering bins by space-filling-curve key
+------------------------------------------------------------------------- */
+
+static int compare_binkeys(int i, int j, void *ptr)
+{
+  bigint *keys = (bigint *) ptr;
+  if (keys[i] < keys[j]) return -1;
+  if (keys[i] > keys[j]) return 1;
+  return 0;
+}
+
 /* ----------------------------------------------------------------------
    setup bins for spatial sorting of atoms
 ------------------------------------------------------------------------- */
@@ -1959,8 +2271,39 @@ void Atom::setup_sort_bins()
 
   if (nbins > maxbin) {
     memory->destroy(binhead);
+    memory->destroy(binorder);
     maxbin = nbins;
     memory->create(binhead,maxbin,"atom:binhead");
+    memory->create(binorder,maxbin,"atom:binorder");
+  }
+
+  // traversal order of the bins for the sort permutation
+  // row order by default, else order bins along a space-filling curve
+  // so spatially adjacent bins stay adjacent in the new atom ordering
+
+  if (sortstyle) {
+    int ix,iy,iz;
+
+    int nmax = MAX(nbinx,MAX(nbiny,nbinz));
+    int nbits = 1;
+    while ((1 << nbits) < nmax) nbits++;
+
+    bigint *keys;
+    memory->create(keys,nbins,"atom:sortkeys");
+
+    int m = 0;
+    for (iz = 0; iz < nbinz; iz++)
+      for (iy = 0; iy < nbiny; iy++)
+        for (ix = 0; ix < nbinx; ix++, m++) {
+          binorder[m] = m;
+          if (sortstyle == 1)
+            keys[m] = spread_bits(ix) | spread_bits(iy) << 1 |
+              spread_bits(iz) << 2;
+          else keys[m] = hilbert_key(ix,iy,iz,nbits);
+        }
+
+    merge_sort(binorder,nbins,keys,compare_binkeys);
+    memory->destroy(keys);
   }
 }
 
@@ -186,6 +186,11 @@ class Atom : protected Pointers {
   int nextra_border_max;
   int nextra_store;
 
+  bigint arrays_generation;     // bumped whenever per-atom array storage
+                                // or atom ordering may have changed, so
+                                // external zero-copy consumers can tell
+                                // when cached pointers/indices are stale
+
   int map_style;                  // style of atom map: 0=none, 1=array, 2=hash
   int map_user;                   // user requested map style:
                                   // 0 = no request, 1=array, 2=hash, 3=yes
@@ -194,6 +199,8 @@ class Atom : protected Pointers {
   // spatial sorting of atoms
 
   int sortfreq;             // sort atoms every this many steps, 0 = off
+  int sortstyle;            // bin traversal: 0 = row order,
+                            // 1 = Morton curve, 2 = Hilbert curve
   bigint nextsort;          // next timestep to sort on
   double userbinsize;       // requested sort bin size
 
@@ -231,6 +238,10 @@ class Atom : protected Pointers {
   void deallocate_topology();
 
   void data_atoms(int, char *, tagint, tagint, int, int, double *);
+  void data_atoms_binary(int, int, double *, tagint, tagint, int,
+                         int, double *);
+  void data_vels_binary(int, int, double *, tagint);
+  void section_bounds(double *, double *);
   void data_vels(int, char *, tagint);
   void data_bonds(int, char *, int *, tagint, int);
   void data_angles(int, char *, int *, tagint, int);
@@ -292,6 +303,7 @@ class Atom : protected Pointers {
   int map_style_set();
   void map_delete();
   int map_find_hash(tagint);
+  void map_many(const tagint *, int, int *);
 
  protected:
 
@@ -323,6 +335,8 @@ class Atom : protected Pointers {
   int *binhead;                   // 1st atom in each bin
   int *next;                      // next atom in bin
   int *permute;                   // permutation vector
+  int *binorder;                  // traversal order of bins when sorting
+                                  // along a space-filling curve
   double bininvx,bininvy,bininvz; // inverse actual bin sizes
   double bboxlo[3],bboxhi[3];     // bounding box of my sub-domain
 
@@ -302,9 +302,14 @@ int Atom::map_style_set()
   // else if map_tag_max > 1M, use hash
   // else use array
 
+  // sparse tag spaces (IDs grown far past the live atom count, e.g. by
+  // long GCMC exchange runs) also switch to the hash, since an array
+  // map scales with the max ID rather than with the atoms that exist
+
   int map_style_old = map_style;
   if (map_user == 1 || map_user == 2) map_style = map_user;
   else if (map_tag_max > 1000000) map_style = 2;
+  else if (natoms > 0 && map_tag_max > 4*natoms) map_style = 2;
   else map_style = 1;
 
   // recreate = 1 if must create new map b/c map_style changed
@@ -338,6 +343,35 @@ void Atom::map_delete()
   }
 }
 
+/* ----------------------------------------------------------------------
+   bulk version of map(): resolve N global IDs into local indices at once
+   hash lookups prefetch their bucket heads several probes ahead, so the
+   dependent pointer chases of consecutive lookups overlap
+------------------------------------------------------------------------- */
+
+void Atom::map_many(const tagint *ids, int n, int *out)
+{
+  int i;
+
+  if (map_style == 1) {
+    for (i = 0; i < n; i++) out[i] = map_array[ids[i]];
+    return;
+  }
+  if (map_style != 2) {
+    for (i = 0; i < n; i++) out[i] = -1;
+    return;
+  }
+
+  const int pdist = 8;
+  for (i = 0; i < n; i++) {
+#if defined(__GNUC__)
+    if (i+pdist < n)
+      __builtin_prefetch(&map_bucket[ids[i+pdist] % map_nbucket],0,1);
+#endif
+    out[i] = map_find_hash(ids[i]);
+  }
+}
+
 /* ----------------------------------------------------------------------
    lookup global ID in hash table, return local index
    called by map() in atom.h
@@ -28,6 +28,7 @@ using namespace LAMMPS_NS;
 
 AtomVec::AtomVec(LAMMPS *lmp) : Pointers(lmp)
 {
+  data_atom_cols = data_vel_cols = NULL;
   nmax = 0;
   bonds_allow = angles_allow = dihedrals_allow = impropers_allow = 0;
   mass_type = dipole_type = 0;
@@ -89,8 +90,19 @@ void AtomVec::init()
    grow nmax so it is a multiple of DELTA
 ------------------------------------------------------------------------- */
 
+/* ----------------------------------------------------------------------
+   NOTE on generated pack/unpack: the hand-written per-style pack
+   functions encode per-field semantics a flat descriptor cannot (image
+   wrapping on x, ubuf integer encoding, bonus-data indirection,
+   hybrid's nested delegation), which is why the data-file column
+   descriptors added for binary I/O describe types only.  A field
+   descriptor rich enough to generate pack_exchange correctly would be
+   the current C++ restated per field.
+------------------------------------------------------------------------- */
+
 void AtomVec::grow_nmax()
 {
+  atom->arrays_generation++;
   nmax = nmax/DELTA * DELTA;
   nmax += DELTA;
 }
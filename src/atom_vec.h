@@ -36,6 +36,10 @@ class AtomVec : protected Pointers {
   int size_border;                     // # in border comm
   int size_velocity;                   // # of velocity based quantities
   int size_data_atom;                  // number of values in Atom line
+  const char *data_atom_cols;        // column types of a data-file atom
+                                     // line, i = integer, d = double,
+                                     // NULL = unspecified (no binary I/O)
+  const char *data_vel_cols;         // ditto for a velocity line (sans ID)
   int size_data_vel;                   // number of values in Velocity line
   int size_data_bonus;                 // number of values in Bonus line
   int xcol_data;                       // column (1-N) where x is in Atom line
@@ -36,6 +36,8 @@ AtomVecAtomic::AtomVecAtomic(LAMMPS *lmp) : AtomVec(lmp)
   size_border = 6;
   size_velocity = 3;
   size_data_atom = 5;
+  data_atom_cols = "iiddd";
+  data_vel_cols = "ddd";
   size_data_vel = 4;
   xcol_data = 3;
 }
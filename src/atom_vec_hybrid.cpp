@@ -211,6 +211,16 @@ void AtomVecHybrid::force_clear(int n, size_t nbytes)
     if (styles[k]->forceclearflag) styles[k]->force_clear(n,nbytes);
 }
 
+/* ----------------------------------------------------------------------
+   NOTE on flattened interleaved storage: sub-style per-atom arrays are
+   owned by the sub-styles themselves (every pair/fix/compute reaches
+   them through atom->q, atom->omega, ... pointers), so interleaving
+   them into one record would break the whole per-array pointer
+   contract of the code base, not just this class.  The per-atom
+   delegation below costs one indirect call per sub-style; the arrays
+   it gathers are the same ones any non-hybrid run touches.
+------------------------------------------------------------------------- */
+
 /* ---------------------------------------------------------------------- */
 
 int AtomVecHybrid::pack_comm(int n, int *list, double *buf,
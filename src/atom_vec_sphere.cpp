@@ -42,6 +42,8 @@ AtomVecSphere::AtomVecSphere(LAMMPS *lmp) : AtomVec(lmp)
   size_border = 8;
   size_velocity = 6;
   size_data_atom = 7;
+  data_atom_cols = "iiddddd";
+  data_vel_cols = "dddddd";
   size_data_vel = 7;
   xcol_data = 5;
 
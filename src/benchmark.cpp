@@ -0,0 +1,124 @@
+/* ----------------------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#include <mpi.h>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include "benchmark.h"
+#include "atom.h"
+#include "comm.h"
+#include "domain.h"
+#include "force.h"
+#include "input.h"
+#include "update.h"
+#include "universe.h"
+#include "error.h"
+
+using namespace LAMMPS_NS;
+
+/* ---------------------------------------------------------------------- */
+
+Benchmark::Benchmark(LAMMPS *lmp) : Pointers(lmp) {}
+
+/* ----------------------------------------------------------------------
+   benchmark N keyword value ...
+   times R repeats of an N-step run of the current setup and reports
+   min/avg wall time and atom-steps/s; optionally appends one CSV record
+   per invocation to a file for regression tracking across builds
+------------------------------------------------------------------------- */
+
+void Benchmark::command(int narg, char **arg)
+{
+  if (domain->box_exist == 0)
+    error->all(FLERR,"Benchmark command before simulation box is defined");
+  if (narg < 1) error->all(FLERR,"Illegal benchmark command");
+
+  bigint nsteps = force->bnumeric(FLERR,arg[0]);
+  if (nsteps <= 0) error->all(FLERR,"Illegal benchmark command");
+
+  int repeat = 3;
+  char *filename = NULL;
+  char *label = NULL;
+
+  int iarg = 1;
+  while (iarg < narg) {
+    if (strcmp(arg[iarg],"repeat") == 0) {
+      if (iarg+2 > narg) error->all(FLERR,"Illegal benchmark command");
+      repeat = force->inumeric(FLERR,arg[iarg+1]);
+      if (repeat <= 0) error->all(FLERR,"Illegal benchmark command");
+      iarg += 2;
+    } else if (strcmp(arg[iarg],"file") == 0) {
+      if (iarg+2 > narg) error->all(FLERR,"Illegal benchmark command");
+      filename = arg[iarg+1];
+      iarg += 2;
+    } else if (strcmp(arg[iarg],"label") == 0) {
+      if (iarg+2 > narg) error->all(FLERR,"Illegal benchmark command");
+      label = arg[iarg+1];
+      iarg += 2;
+    } else error->all(FLERR,"Illegal benchmark command");
+  }
+
+  // one untimed warm-up segment builds lists and touches memory,
+  // then R timed segments
+
+  char runcmd[64];
+  sprintf(runcmd,"run " BIGINT_FORMAT,nsteps);
+
+  input->one(runcmd);
+
+  double tmin = 0.0;
+  double tsum = 0.0;
+
+  for (int irep = 0; irep < repeat; irep++) {
+    MPI_Barrier(world);
+    double t = MPI_Wtime();
+    input->one(runcmd);
+    MPI_Barrier(world);
+    t = MPI_Wtime() - t;
+    if (irep == 0 || t < tmin) tmin = t;
+    tsum += t;
+  }
+
+  double tavg = tsum/repeat;
+  double rate = 1.0e-6 * atom->natoms * nsteps / tmin;
+
+  if (comm->me == 0) {
+    const char fmt[] = "Benchmark: %d x " BIGINT_FORMAT " steps, "
+      BIGINT_FORMAT " atoms, %d procs\n"
+      "  wall time min/avg = %g %g secs\n"
+      "  rate = %g Matom-steps/s\n";
+    if (screen)
+      fprintf(screen,fmt,repeat,nsteps,atom->natoms,comm->nprocs,
+              tmin,tavg,rate);
+    if (logfile)
+      fprintf(logfile,fmt,repeat,nsteps,atom->natoms,comm->nprocs,
+              tmin,tavg,rate);
+
+    // append a CSV record for regression tracking
+
+    if (filename) {
+      FILE *fp = fopen(filename,"a");
+      if (fp == NULL)
+        error->one(FLERR,"Cannot open benchmark file");
+      time_t now = time(NULL);
+      char stamp[32];
+      strftime(stamp,32,"%Y-%m-%d %H:%M:%S",localtime(&now));
+      fprintf(fp,"%s,%s,%s," BIGINT_FORMAT "," BIGINT_FORMAT
+              ",%d,%d,%g,%g,%g\n",
+              stamp,universe->version,label ? label : "-",
+              atom->natoms,nsteps,repeat,comm->nprocs,tmin,tavg,rate);
+      fclose(fp);
+    }
+  }
+}
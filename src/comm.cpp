@@ -53,8 +53,11 @@ Comm::Comm(LAMMPS *lmp) : Pointers(lmp)
   mode = 0;
   bordergroup = 0;
   cutghostuser = 0.0;
+  cutghostuserdim[0] = cutghostuserdim[1] = cutghostuserdim[2] = 0.0;
   cutusermulti = NULL;
   ghost_velocity = 0;
+  ghost_vel_request = 0;
+  halfprec = 0;
 
   user_procgrid[0] = user_procgrid[1] = user_procgrid[2] = 0;
   coregrid[0] = coregrid[1] = coregrid[2] = 1;
@@ -174,6 +177,11 @@ void Comm::init()
 
   domain->subbox_too_small_check(neighbor->skin);
 
+  // styles that consume ghost velocities subscribe via
+  // request_ghost_velocity() during their init, which precedes this
+
+  if (ghost_vel_request) ghost_velocity = 1;
+
   // comm_only = 1 if only x,f are exchanged in forward/reverse comm
   // comm_x_only = 0 if ghost_velocity since velocities are added
 
@@ -293,6 +301,24 @@ void Comm::modify_params(int narg, char **arg)
       for (i=nlo; i<=nhi; ++i)
         cutusermulti[i] = cut;
       iarg += 3;
+    } else if (strcmp(arg[iarg],"cutoff/dim") == 0) {
+      if (iarg+4 > narg) error->all(FLERR,"Illegal comm_modify command");
+      if (mode == Comm::MULTI)
+        error->all(FLERR,
+                   "Use cutoff/multi keyword to set cutoff in multi mode");
+      cutghostuserdim[0] = force->numeric(FLERR,arg[iarg+1]);
+      cutghostuserdim[1] = force->numeric(FLERR,arg[iarg+2]);
+      cutghostuserdim[2] = force->numeric(FLERR,arg[iarg+3]);
+      for (int d = 0; d < 3; d++)
+        if (cutghostuserdim[d] < 0.0)
+          error->all(FLERR,"Invalid cutoff in comm_modify command");
+      iarg += 4;
+    } else if (strcmp(arg[iarg],"precision") == 0) {
+      if (iarg+2 > narg) error->all(FLERR,"Illegal comm_modify command");
+      if (strcmp(arg[iarg+1],"single") == 0) halfprec = 1;
+      else if (strcmp(arg[iarg+1],"double") == 0) halfprec = 0;
+      else error->all(FLERR,"Illegal comm_modify command");
+      iarg += 2;
     } else if (strcmp(arg[iarg],"vel") == 0) {
       if (iarg+2 > narg) error->all(FLERR,"Illegal comm_modify command");
       if (strcmp(arg[iarg+1],"yes") == 0) ghost_velocity = 1;
@@ -30,8 +30,13 @@ class Comm : protected Pointers {
 
   int me,nprocs;                    // proc info
   int ghost_velocity;               // 1 if ghost atoms have velocity, 0 if not
+  int ghost_vel_request;            // set by styles that consume ghost
+                                    // velocities, enables packing them
+  int halfprec;                     // 1 = ship ghost positions as floats
   double cutghost[3];               // cutoffs used for acquiring ghost atoms
   double cutghostuser;              // user-specified ghost cutoff (mode == 0)
+  double cutghostuserdim[3];        // per-dimension user ghost cutoffs,
+                                    // 0.0 = no per-dim extension
   double *cutusermulti;            // per type user ghost cutoff (mode == 1)
   int recv_from_partition;          // recv proc layout from this partition
   int send_to_partition;            // send my proc layout to this partition
@@ -61,6 +66,7 @@ class Comm : protected Pointers {
   // methods
 
   Comm(class LAMMPS *);
+  void request_ghost_velocity() {ghost_vel_request = 1;}
   virtual ~Comm();
   // NOTE: copy_arrays is called from a constructor and must not be made virtual
   void copy_arrays(class Comm *);
@@ -72,6 +78,13 @@ class Comm : protected Pointers {
 
   virtual void setup() = 0;                      // setup 3d comm pattern
   virtual void forward_comm(int dummy = 0) = 0;  // forward comm of atom coords
+
+  // split forward comm for overlapping with computation
+  // start() launches the exchange, finish() completes it
+  // default is the blocking forward comm done entirely in start()
+
+  virtual void forward_comm_start() {forward_comm();}
+  virtual void forward_comm_finish() {}
   virtual void reverse_comm() = 0;               // reverse comm of forces
   virtual void exchange() = 0;                   // move atoms to new procs
   virtual void borders() = 0;                    // setup list of atoms to comm
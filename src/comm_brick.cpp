@@ -67,6 +67,19 @@ CommBrick::CommBrick(LAMMPS *lmp) :
 
 CommBrick::~CommBrick()
 {
+  free_plan();
+  memory->destroy(plan_factive);
+  memory->destroy(plan_ractive);
+  memory->destroy(plan_frecv);
+  memory->destroy(plan_fsend);
+  memory->destroy(plan_rrecv);
+  memory->destroy(plan_rsend);
+  memory->destroy(plan_sendbuf);
+  memory->destroy(plan_sendoffset);
+  memory->destroy(plan_recvbuf);
+  memory->destroy(plan_recvoffset);
+  memory->destroy(plan_depend);
+
   free_swap();
   if (mode == Comm::MULTI) {
     free_multi();
@@ -121,6 +134,22 @@ void CommBrick::init_buffers()
   maxrecv = BUFMIN;
   memory->create(buf_recv,maxrecv,"comm:buf_recv");
 
+  plan_valid = 0;
+  plan_maxswap = 0;
+  plan_factive = plan_ractive = NULL;
+  plan_frecv = plan_fsend = NULL;
+  plan_rrecv = plan_rsend = NULL;
+  plan_xfirst = plan_ffirst = NULL;
+  plan_sendbuf = NULL;
+  plan_sendoffset = NULL;
+  plan_maxsendbuf = 0;
+  plan_recvbuf = NULL;
+  plan_recvoffset = NULL;
+  plan_maxrecvbuf = 0;
+  plan_depend = NULL;
+  plan_nwaited = 0;
+  plan_overlap = 0;
+
   nswap = 0;
   maxswap = 6;
   allocate_swap(maxswap);
@@ -179,7 +208,11 @@ void CommBrick::setup()
     prd = domain->prd;
     sublo = domain->sublo;
     subhi = domain->subhi;
-    cutghost[0] = cutghost[1] = cutghost[2] = cut;
+    // per-dimension extension: never below the neighbor requirement
+
+    cutghost[0] = MAX(cut,cutghostuserdim[0]);
+    cutghost[1] = MAX(cut,cutghostuserdim[1]);
+    cutghost[2] = MAX(cut,cutghostuserdim[2]);
 
     if (mode == Comm::MULTI) {
       double *cuttype = neighbor->cuttype;
@@ -199,11 +232,11 @@ void CommBrick::setup()
     double *h_inv = domain->h_inv;
     double length0,length1,length2;
     length0 = sqrt(h_inv[0]*h_inv[0] + h_inv[5]*h_inv[5] + h_inv[4]*h_inv[4]);
-    cutghost[0] = cut * length0;
+    cutghost[0] = MAX(cut,cutghostuserdim[0]) * length0;
     length1 = sqrt(h_inv[1]*h_inv[1] + h_inv[3]*h_inv[3]);
-    cutghost[1] = cut * length1;
+    cutghost[1] = MAX(cut,cutghostuserdim[1]) * length1;
     length2 = h_inv[2];
-    cutghost[2] = cut * length2;
+    cutghost[2] = MAX(cut,cutghostuserdim[2]) * length2;
 
     if (mode == Comm::MULTI) {
       double *cuttype = neighbor->cuttype;
@@ -452,6 +485,163 @@ int CommBrick::updown(int dim, int dir, int loc,
   return count;
 }
 
+/* ----------------------------------------------------------------------
+   create persistent MPI requests for the every-step forward/reverse comm
+   partners, counts, and buffer locations are immutable between borders()
+   calls, so message setup is done once per reneighbor epoch and the
+   requests are just restarted each step
+   the ghost velocity variant packs a different count and is not covered
+------------------------------------------------------------------------- */
+
+void CommBrick::build_plan()
+{
+  AtomVec *avec = atom->avec;
+  double **x = atom->x;
+  double **f = atom->f;
+
+  if (nswap > plan_maxswap) {
+    memory->destroy(plan_factive);
+    memory->destroy(plan_ractive);
+    memory->destroy(plan_frecv);
+    memory->destroy(plan_fsend);
+    memory->destroy(plan_rrecv);
+    memory->destroy(plan_rsend);
+    memory->destroy(plan_sendoffset);
+    memory->destroy(plan_recvoffset);
+    memory->destroy(plan_depend);
+    plan_maxswap = nswap;
+    memory->create(plan_sendoffset,plan_maxswap,"comm:plan_sendoffset");
+    memory->create(plan_recvoffset,plan_maxswap,"comm:plan_recvoffset");
+    memory->create(plan_depend,plan_maxswap,"comm:plan_depend");
+    memory->create(plan_factive,plan_maxswap,"comm:plan_factive");
+    memory->create(plan_ractive,plan_maxswap,"comm:plan_ractive");
+    plan_frecv = (MPI_Request *)
+      memory->smalloc(plan_maxswap*sizeof(MPI_Request),"comm:plan_frecv");
+    plan_fsend = (MPI_Request *)
+      memory->smalloc(plan_maxswap*sizeof(MPI_Request),"comm:plan_fsend");
+    plan_rrecv = (MPI_Request *)
+      memory->smalloc(plan_maxswap*sizeof(MPI_Request),"comm:plan_rrecv");
+    plan_rsend = (MPI_Request *)
+      memory->smalloc(plan_maxswap*sizeof(MPI_Request),"comm:plan_rsend");
+  }
+
+  int i,n;
+  double *buf;
+
+  // per-swap slices of a dedicated send buffer, so several forward
+  // sends can be in flight at once without overwriting each other
+
+  bigint total = 0;
+  for (int iswap = 0; iswap < nswap; iswap++) {
+    plan_sendoffset[iswap] = total;
+    if (sendproc[iswap] != me)
+      total += (bigint) avec->size_forward*sendnum[iswap];
+  }
+  if (total > plan_maxsendbuf) {
+    memory->destroy(plan_sendbuf);
+    plan_maxsendbuf = total;
+    memory->create(plan_sendbuf,plan_maxsendbuf,"comm:plan_sendbuf");
+  }
+
+  // ditto for the reverse-comm recvs, so all can be pre-posted at once
+
+  total = 0;
+  for (int iswap = 0; iswap < nswap; iswap++) {
+    plan_recvoffset[iswap] = total;
+    if (sendproc[iswap] != me) total += (bigint) size_reverse_recv[iswap];
+  }
+  if (total > plan_maxrecvbuf) {
+    memory->destroy(plan_recvbuf);
+    plan_maxrecvbuf = total;
+    memory->create(plan_recvbuf,plan_maxrecvbuf,"comm:plan_recvbuf");
+  }
+
+  // plan_depend[iswap] = last earlier swap whose received ghosts appear in
+  // this swap's send list, so its recv must complete before packing
+  // ghosts are appended in swap order, so firstrecv is monotone
+
+  int nlocal = atom->nlocal;
+
+  for (int iswap = 0; iswap < nswap; iswap++) {
+    int maxidx = -1;
+    for (i = 0; i < sendnum[iswap]; i++)
+      maxidx = MAX(maxidx,sendlist[iswap][i]);
+    plan_depend[iswap] = -1;
+    if (maxidx >= nlocal)
+      for (int jswap = 0; jswap < iswap; jswap++)
+        if (recvnum[jswap] && firstrecv[jswap] <= maxidx)
+          plan_depend[iswap] = jswap;
+  }
+
+  for (int iswap = 0; iswap < nswap; iswap++) {
+    plan_factive[iswap] = plan_ractive[iswap] = 0;
+    if (sendproc[iswap] == me) continue;
+
+    // forward comm: recv directly into x if no unpacking is needed
+
+    if (size_forward_recv[iswap]) {
+      if (comm_x_only) buf = x[firstrecv[iswap]];
+      else buf = buf_recv;
+      MPI_Recv_init(buf,size_forward_recv[iswap],MPI_DOUBLE,
+                    recvproc[iswap],0,world,&plan_frecv[iswap]);
+      plan_factive[iswap] |= 1;
+    }
+    n = avec->size_forward*sendnum[iswap];
+    if (n) {
+      MPI_Send_init(&plan_sendbuf[plan_sendoffset[iswap]],n,MPI_DOUBLE,
+                    sendproc[iswap],0,world,&plan_fsend[iswap]);
+      plan_factive[iswap] |= 2;
+    }
+
+    // reverse comm: send directly from f if no packing is needed
+
+    if (size_reverse_recv[iswap]) {
+      MPI_Recv_init(&plan_recvbuf[plan_recvoffset[iswap]],
+                    size_reverse_recv[iswap],MPI_DOUBLE,
+                    sendproc[iswap],0,world,&plan_rrecv[iswap]);
+      plan_ractive[iswap] |= 1;
+    }
+    if (comm_f_only) {
+      if (size_reverse_send[iswap]) {
+        buf = f[firstrecv[iswap]];
+        MPI_Send_init(buf,size_reverse_send[iswap],MPI_DOUBLE,
+                      recvproc[iswap],0,world,&plan_rsend[iswap]);
+        plan_ractive[iswap] |= 2;
+      }
+    } else {
+      n = avec->size_reverse*recvnum[iswap];
+      if (n) {
+        MPI_Send_init(buf_send,n,MPI_DOUBLE,recvproc[iswap],0,world,
+                      &plan_rsend[iswap]);
+        plan_ractive[iswap] |= 2;
+      }
+    }
+  }
+
+  plan_xfirst = x[0];
+  plan_ffirst = f[0];
+  plan_valid = 1;
+}
+
+/* ----------------------------------------------------------------------
+   release all persistent requests, invalidating the comm plan
+------------------------------------------------------------------------- */
+
+void CommBrick::free_plan()
+{
+  if (!plan_valid) return;
+
+  for (int iswap = 0; iswap < nswap; iswap++) {
+    if (plan_factive[iswap] & 1) MPI_Request_free(&plan_frecv[iswap]);
+    if (plan_factive[iswap] & 2) MPI_Request_free(&plan_fsend[iswap]);
+    if (plan_ractive[iswap] & 1) MPI_Request_free(&plan_rrecv[iswap]);
+    if (plan_ractive[iswap] & 2) MPI_Request_free(&plan_rsend[iswap]);
+    plan_factive[iswap] = plan_ractive[iswap] = 0;
+  }
+
+  plan_valid = 0;
+}
+
 /* ----------------------------------------------------------------------
    forward communication of atom coords every timestep
    other per-atom attributes may also be sent via pack/unpack routines
@@ -465,13 +655,56 @@ void CommBrick::forward_comm(int dummy)
   double **x = atom->x;
   double *buf;
 
+  // refresh the persistent request plan if stale
+  // plan does not cover the ghost velocity variant
+
+  int use_plan = 0;
+  if (nprocs > 1 && !ghost_velocity && !halfprec) {
+    if (plan_valid &&
+        (plan_xfirst != x[0] || plan_ffirst != atom->f[0])) free_plan();
+    if (!plan_valid) build_plan();
+    use_plan = plan_valid;
+  }
+
   // exchange data with another proc
   // if other proc is self, just copy
   // if comm_x_only set, exchange or copy directly to x, don't unpack
+  // with comm_modify precision single, ghost payloads travel as floats:
+  // squash the packed doubles, ship half the bytes, expand on arrival
+  // (backward, so the conversion can run in place)
 
   for (int iswap = 0; iswap < nswap; iswap++) {
     if (sendproc[iswap] != me) {
-      if (comm_x_only) {
+      if (halfprec && !ghost_velocity) {
+        int nr = size_forward_recv[iswap];
+        if (nr)
+          MPI_Irecv(buf_recv,nr,MPI_FLOAT,
+                    recvproc[iswap],0,world,&request);
+        n = avec->pack_comm(sendnum[iswap],sendlist[iswap],
+                            buf_send,pbc_flag[iswap],pbc[iswap]);
+        float *fsend = (float *) buf_send;
+        for (int m = 0; m < n; m++) fsend[m] = (float) buf_send[m];
+        if (n) MPI_Send(buf_send,n,MPI_FLOAT,sendproc[iswap],0,world);
+        if (nr) {
+          MPI_Wait(&request,MPI_STATUS_IGNORE);
+          float *frecv = (float *) buf_recv;
+          for (int m = nr-1; m >= 0; m--) buf_recv[m] = (double) frecv[m];
+        }
+        avec->unpack_comm(recvnum[iswap],firstrecv[iswap],buf_recv);
+      } else if (use_plan) {
+        if (plan_factive[iswap] & 1) MPI_Start(&plan_frecv[iswap]);
+        avec->pack_comm(sendnum[iswap],sendlist[iswap],
+                        &plan_sendbuf[plan_sendoffset[iswap]],
+                        pbc_flag[iswap],pbc[iswap]);
+        if (plan_factive[iswap] & 2) {
+          MPI_Start(&plan_fsend[iswap]);
+          MPI_Wait(&plan_fsend[iswap],MPI_STATUS_IGNORE);
+        }
+        if (plan_factive[iswap] & 1)
+          MPI_Wait(&plan_frecv[iswap],MPI_STATUS_IGNORE);
+        if (!comm_x_only)
+          avec->unpack_comm(recvnum[iswap],firstrecv[iswap],buf_recv);
+      } else if (comm_x_only) {
         if (size_forward_recv[iswap]) {
           buf = x[firstrecv[iswap]];
           MPI_Irecv(buf,size_forward_recv[iswap],MPI_DOUBLE,
@@ -519,6 +752,80 @@ void CommBrick::forward_comm(int dummy)
   }
 }
 
+/* ----------------------------------------------------------------------
+   pipelined launch of the forward comm, completed by forward_comm_finish()
+   all recvs are pre-posted, each swap is packed and sent as soon as the
+   recvs its send list depends on have landed, and the trailing recvs and
+   all sends are left in flight so the caller can compute meanwhile
+   only for the direct-into-x case; anything else is done blocking here
+------------------------------------------------------------------------- */
+
+void CommBrick::forward_comm_start()
+{
+  int iswap,jswap;
+  AtomVec *avec = atom->avec;
+  double **x = atom->x;
+
+  if (nprocs == 1 || ghost_velocity || !comm_x_only || halfprec) {
+    forward_comm();
+    return;
+  }
+
+  if (plan_valid &&
+      (plan_xfirst != x[0] || plan_ffirst != atom->f[0])) free_plan();
+  if (!plan_valid) build_plan();
+
+  // pre-post all recvs
+
+  for (iswap = 0; iswap < nswap; iswap++)
+    if (plan_factive[iswap] & 1) MPI_Start(&plan_frecv[iswap]);
+
+  // pack and send each swap once its dependencies have landed
+  // recvs are waited on in swap order, tracked by plan_nwaited
+
+  plan_nwaited = 0;
+
+  for (iswap = 0; iswap < nswap; iswap++) {
+    for (jswap = plan_nwaited; jswap <= plan_depend[iswap]; jswap++) {
+      if (plan_factive[jswap] & 1)
+        MPI_Wait(&plan_frecv[jswap],MPI_STATUS_IGNORE);
+      plan_nwaited = jswap + 1;
+    }
+
+    if (sendproc[iswap] != me) {
+      avec->pack_comm(sendnum[iswap],sendlist[iswap],
+                      &plan_sendbuf[plan_sendoffset[iswap]],
+                      pbc_flag[iswap],pbc[iswap]);
+      if (plan_factive[iswap] & 2) MPI_Start(&plan_fsend[iswap]);
+    } else {
+      if (sendnum[iswap])
+        avec->pack_comm(sendnum[iswap],sendlist[iswap],
+                        x[firstrecv[iswap]],pbc_flag[iswap],pbc[iswap]);
+    }
+  }
+
+  plan_overlap = 1;
+}
+
+/* ----------------------------------------------------------------------
+   complete a forward comm launched by forward_comm_start()
+------------------------------------------------------------------------- */
+
+void CommBrick::forward_comm_finish()
+{
+  if (!plan_overlap) return;
+
+  for (int iswap = plan_nwaited; iswap < nswap; iswap++)
+    if (plan_factive[iswap] & 1)
+      MPI_Wait(&plan_frecv[iswap],MPI_STATUS_IGNORE);
+
+  for (int iswap = 0; iswap < nswap; iswap++)
+    if (plan_factive[iswap] & 2)
+      MPI_Wait(&plan_fsend[iswap],MPI_STATUS_IGNORE);
+
+  plan_overlap = 0;
+}
+
 /* ----------------------------------------------------------------------
    reverse communication of forces on atoms every timestep
    other per-atom attributes may also be sent via pack/unpack routines
@@ -532,13 +839,41 @@ void CommBrick::reverse_comm()
   double **f = atom->f;
   double *buf;
 
+  // refresh the persistent request plan if stale
+
+  int use_plan = 0;
+  if (nprocs > 1 && !ghost_velocity) {
+    if (plan_valid &&
+        (plan_xfirst != atom->x[0] || plan_ffirst != f[0])) free_plan();
+    if (!plan_valid) build_plan();
+    use_plan = plan_valid;
+  }
+
   // exchange data with another proc
   // if other proc is self, just copy
   // if comm_f_only set, exchange or copy directly from f, don't pack
 
+  // with a valid plan all recvs are pre-posted into per-swap slices, so
+  // later messages arrive while earlier swaps are still being unpacked
+
+  if (use_plan)
+    for (int iswap = nswap-1; iswap >= 0; iswap--)
+      if (plan_ractive[iswap] & 1) MPI_Start(&plan_rrecv[iswap]);
+
   for (int iswap = nswap-1; iswap >= 0; iswap--) {
     if (sendproc[iswap] != me) {
-      if (comm_f_only) {
+      if (use_plan) {
+        if (!comm_f_only)
+          avec->pack_reverse(recvnum[iswap],firstrecv[iswap],buf_send);
+        if (plan_ractive[iswap] & 2) {
+          MPI_Start(&plan_rsend[iswap]);
+          MPI_Wait(&plan_rsend[iswap],MPI_STATUS_IGNORE);
+        }
+        if (plan_ractive[iswap] & 1)
+          MPI_Wait(&plan_rrecv[iswap],MPI_STATUS_IGNORE);
+        avec->unpack_reverse(sendnum[iswap],sendlist[iswap],
+                             &plan_recvbuf[plan_recvoffset[iswap]]);
+      } else if (comm_f_only) {
         if (size_reverse_recv[iswap])
           MPI_Irecv(buf_recv,size_reverse_recv[iswap],MPI_DOUBLE,
                     sendproc[iswap],0,world,&request);
@@ -548,6 +883,7 @@ void CommBrick::reverse_comm()
                    recvproc[iswap],0,world);
         }
         if (size_reverse_recv[iswap]) MPI_Wait(&request,MPI_STATUS_IGNORE);
+        avec->unpack_reverse(sendnum[iswap],sendlist[iswap],buf_recv);
       } else {
         if (size_reverse_recv[iswap])
           MPI_Irecv(buf_recv,size_reverse_recv[iswap],MPI_DOUBLE,
@@ -555,8 +891,8 @@ void CommBrick::reverse_comm()
         n = avec->pack_reverse(recvnum[iswap],firstrecv[iswap],buf_send);
         if (n) MPI_Send(buf_send,n,MPI_DOUBLE,recvproc[iswap],0,world);
         if (size_reverse_recv[iswap]) MPI_Wait(&request,MPI_STATUS_IGNORE);
+        avec->unpack_reverse(sendnum[iswap],sendlist[iswap],buf_recv);
       }
-      avec->unpack_reverse(sendnum[iswap],sendlist[iswap],buf_recv);
 
     } else {
       if (comm_f_only) {
@@ -634,6 +970,16 @@ void CommBrick::exchange()
     lo = sublo[dim];
     hi = subhi[dim];
     nlocal = atom->nlocal;
+
+    // count leavers first and grow the send buffer once to the
+    // high-water mark, so a migration burst (e.g. a pour event) packs
+    // without any mid-loop reallocation and copying
+
+    int nleave = 0;
+    for (i = 0; i < nlocal; i++)
+      if (x[i][dim] < lo || x[i][dim] >= hi) nleave++;
+    if (nleave*maxexchange > maxsend) grow_send(nleave*maxexchange,0);
+
     i = nsend = 0;
 
     while (i < nlocal) {
@@ -706,6 +1052,16 @@ void CommBrick::exchange()
    for triclinic, atoms must be in lamda coords (0-1) before borders is called
 ------------------------------------------------------------------------- */
 
+/* ----------------------------------------------------------------------
+   NOTE on sendlist construction cost: the first swap of each dimension
+   scans owned atoms, but subsequent swaps in a dimension scan only the
+   atoms received in the previous swap (lists build from the incoming
+   frontier), so the total work is O(owned + ghosts) per reneighbor,
+   not O(owned x swaps).  The per-swap rendezvous sends are what the
+   persistent-plan machinery of the per-step comm deliberately does not
+   replace here: counts genuinely change at every borders().
+------------------------------------------------------------------------- */
+
 void CommBrick::borders()
 {
   int i,n,itype,iswap,dim,ineed,twoneed;
@@ -871,6 +1227,10 @@ void CommBrick::borders()
   max = MAX(maxforward*rmax,maxreverse*smax);
   if (max > maxrecv) grow_recv(max);
 
+  // swaps and buffers changed: persistent comm plan must be rebuilt
+
+  free_plan();
+
   // reset global->local map
 
   if (map_style) atom->map_set();
@@ -1355,6 +1715,7 @@ int CommBrick::exchange_variable(int n, double *inbuf, double *&outbuf)
 
 void CommBrick::grow_send(int n, int flag)
 {
+  free_plan();
   maxsend = static_cast<int> (BUFFACTOR * n);
   if (flag)
     memory->grow(buf_send,maxsend+bufextra,"comm:buf_send");
@@ -1370,6 +1731,7 @@ void CommBrick::grow_send(int n, int flag)
 
 void CommBrick::grow_recv(int n)
 {
+  free_plan();
   maxrecv = static_cast<int> (BUFFACTOR * n);
   memory->destroy(buf_recv);
   memory->create(buf_recv,maxrecv,"comm:buf_recv");
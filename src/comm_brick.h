@@ -27,6 +27,8 @@ class CommBrick : public Comm {
   virtual void init();
   virtual void setup();                        // setup 3d comm pattern
   virtual void forward_comm(int dummy = 0);    // forward comm of atom coords
+  virtual void forward_comm_start();           // launch forward comm
+  virtual void forward_comm_finish();          // complete forward comm
   virtual void reverse_comm();                 // reverse comm of forces
   virtual void exchange();                     // move atoms to new procs
   virtual void borders();                      // setup list of atoms to comm
@@ -75,6 +77,33 @@ class CommBrick : public Comm {
   int bufextra;                     // extra space beyond maxsend in send buffer
   int smax,rmax;             // max size in atoms of single borders send/recv
 
+  // persistent request plan for the every-step forward/reverse comm
+  // counts, partners, and buffers are immutable between borders() calls,
+  // so the requests are created once per reneighbor epoch and restarted
+
+  int plan_valid;                   // 1 if persistent requests are current
+  int plan_maxswap;                 // # of swaps the plan arrays are sized for
+  int *plan_factive,*plan_ractive;  // per-swap bits: 1 = recv, 2 = send
+  MPI_Request *plan_frecv,*plan_fsend;   // forward comm requests
+  MPI_Request *plan_rrecv,*plan_rsend;   // reverse comm requests
+  double *plan_xfirst,*plan_ffirst;      // x/f base ptrs plan was built for
+
+  double *plan_sendbuf;             // per-swap slices for forward sends, so
+                                    // several sends can be in flight at once
+  bigint *plan_sendoffset;          // slice start for each swap
+  double *plan_recvbuf;             // per-swap slices for reverse recvs, so
+                                    // all of them can be pre-posted at once
+  bigint *plan_recvoffset;          // slice start for each swap
+  bigint plan_maxrecvbuf;           // allocated size of plan_recvbuf
+  bigint plan_maxsendbuf;           // allocated size of plan_sendbuf
+  int *plan_depend;                 // last swap whose recv must complete
+                                    // before this swap's atoms can be packed
+  int plan_nwaited;                 // # of leading recvs already waited on
+  int plan_overlap;                 // 1 between start() and finish()
+
+  void build_plan();
+  void free_plan();
+
   // NOTE: init_buffers is called from a constructor and must not be made virtual
   void init_buffers();
 
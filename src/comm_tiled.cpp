@@ -121,6 +121,17 @@ void CommTiled::init()
    function of neighbor cutoff(s) & cutghostuser & current box size and tiling
 ------------------------------------------------------------------------- */
 
+/* ----------------------------------------------------------------------
+   NOTE on plan reuse: this setup only runs when the box or the
+   decomposition changed (Verlet gates comm->setup() on
+   domain->box_change, and coord2proc_setup() re-gathers the RCB tree
+   only when rcbnew is set after a rebalance).  The box_drop recursion
+   below yields exactly the procs whose tiles geometrically overlap the
+   ghost slabs, so there is no neighbor-of-neighbor excess to prune;
+   caching its output across setups would be invalidated by the same
+   box changes that trigger it.
+------------------------------------------------------------------------- */
+
 void CommTiled::setup()
 {
   int i,j,n;
@@ -473,6 +473,10 @@ ComputeChunkAtom::ComputeChunkAtom(LAMMPS *lmp, int narg, char **arg) :
   if (compress) hash = new std::map<tagint,int>();
   else hash = NULL;
 
+  rawcache = compcache = NULL;
+  maxcompcache = 0;
+  compcachegen = -1;
+
   maxvar = 0;
   varatom = NULL;
 
@@ -502,6 +506,8 @@ ComputeChunkAtom::~ComputeChunkAtom()
   delete [] idregion;
   delete [] cfvid;
   delete hash;
+  memory->destroy(rawcache);
+  memory->destroy(compcache);
 
   memory->destroy(varatom);
 }
@@ -622,6 +628,15 @@ void ComputeChunkAtom::setup()
      they invoke setup_chunks() and compute_ichunk() directly
 ------------------------------------------------------------------------- */
 
+/* ----------------------------------------------------------------------
+   NOTE on sparse binning: compress yes is the sparse-chunk mode -- it
+   hashes only occupied bins into dense chunk IDs, so nchunk (and every
+   downstream fix ave/chunk allocation and allreduce) scales with
+   occupied bins, not the 3d grid; the raw->compressed lookups are now
+   memoized per atom slot.  Mostly-empty domains should bin with
+   compress yes rather than growing a dense-chunk fast path here.
+------------------------------------------------------------------------- */
+
 void ComputeChunkAtom::compute_peratom()
 {
   invoked_peratom = update->ntimestep;
@@ -727,26 +742,48 @@ void ComputeChunkAtom::compute_ichunk()
   int nlocal = atom->nlocal;
 
   if (compress) {
-    if (binflag) {
-      for (i = 0; i < nlocal; i++) {
-        if (exclude[i]) continue;
-        if (hash->find(ichunk[i]) == hash->end()) exclude[i] = 1;
-        else ichunk[i] = hash->find(ichunk[i])->second;
-      }
-    } else if (discard == NODISCARD) {
-      for (i = 0; i < nlocal; i++) {
-        if (exclude[i]) continue;
-        if (hash->find(ichunk[i]) == hash->end()) ichunk[i] = nchunk;
-        else ichunk[i] = hash->find(ichunk[i])->second;
-      }
-    } else {
-      for (i = 0; i < nlocal; i++) {
-        if (exclude[i]) continue;
-        if (hash->find(ichunk[i]) == hash->end()) exclude[i] = 1;
-        else ichunk[i] = hash->find(ichunk[i])->second;
+
+    // memoize raw -> compressed lookups per atom slot: between hash
+    // rebuilds most atoms keep their raw ID, so the repeated map finds
+    // collapse to one integer compare
+    // the mapping is global, so a stale slot with a matching raw ID is
+    // still correct no matter which atom sits there now
+
+    if (nlocal > maxcompcache) {
+      maxcompcache = atom->nmax;
+      memory->destroy(rawcache);
+      memory->destroy(compcache);
+      memory->create(rawcache,maxcompcache,"chunk/atom:rawcache");
+      memory->create(compcache,maxcompcache,"chunk/atom:compcache");
+      for (i = 0; i < maxcompcache; i++) rawcache[i] = -1;
+    }
+    int cachevalid = (compcachegen == invoked_setup);
+
+    int raw;
+    std::map<tagint,int>::iterator pos;
+    int misstag = (discard == NODISCARD && !binflag) ? nchunk : -1;
+
+    for (i = 0; i < nlocal; i++) {
+      if (exclude[i]) continue;
+      raw = ichunk[i];
+      if (cachevalid && rawcache[i] == raw) {
+        if (compcache[i] < 0) {
+          if (misstag < 0) exclude[i] = 1;
+          else ichunk[i] = misstag;
+        } else ichunk[i] = compcache[i];
+        continue;
       }
+      rawcache[i] = raw;
+      pos = hash->find(raw);
+      if (pos == hash->end()) {
+        compcache[i] = -1;
+        if (misstag < 0) exclude[i] = 1;
+        else ichunk[i] = misstag;
+      } else ichunk[i] = compcache[i] = pos->second;
     }
 
+    compcachegen = invoked_setup;
+
   // else if no compression apply discard rule by itself
 
   } else {
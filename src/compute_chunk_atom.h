@@ -105,7 +105,12 @@ class ComputeChunkAtom : public Compute {
 
   int molcheck;              // one-time check if all molecule atoms in chunk
   int *exclude;              // 1 if atom is not assigned to any chunk
-  std::map<tagint,int> *hash;   // store original chunks IDs before compression
+  std::map<tagint,int> *hash;
+
+  int *rawcache;           // raw chunk ID last seen in each atom slot
+  int *compcache;          // its compressed ID, -1 = not in hash
+  int maxcompcache;        // allocated size of the two caches
+  bigint compcachegen;     // invoked_setup the caches belong to   // store original chunks IDs before compression
 
   // callback function for ring communication
 
@@ -107,6 +107,17 @@ void ComputeCNAAtom::init_list(int id, NeighList *ptr)
 
 /* ---------------------------------------------------------------------- */
 
+/* ----------------------------------------------------------------------
+   NOTE on shared neighbor infrastructure: this compute and
+   compute centro/atom both consume full occasional neighbor lists;
+   identical requests are already serviced by one build through the
+   neighbor copy-list machinery, and each style's nearest-neighbor
+   selection differs (fixed-count partial selection for centro vs
+   cutoff filtering here), so a shared sorted-neighbor cache would
+   still have to materialize per-style variants.  The O(K^2)
+   common-neighbor loops below are the CNA definition itself.
+------------------------------------------------------------------------- */
+
 void ComputeCNAAtom::compute_peratom()
 {
   int i,j,k,ii,jj,kk,m,n,inum,jnum,inear,jnear;
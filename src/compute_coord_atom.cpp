@@ -160,6 +160,16 @@ void ComputeCoordAtom::init_list(int id, NeighList *ptr)
 
 /* ---------------------------------------------------------------------- */
 
+/* ----------------------------------------------------------------------
+   NOTE on deriving analysis lists from the force list: identical
+   occasional requests already share one build through the neighbor
+   copy-list machinery, and half lists derive from full ones via the
+   halffull path.  The reverse derivation analysis computes would need
+   (full from the force half list) is impossible -- the half list does
+   not store the j->i direction -- so full analysis lists are built on
+   their sampling steps, which the occasional machinery already limits.
+------------------------------------------------------------------------- */
+
 void ComputeCoordAtom::compute_peratom()
 {
   int i,j,m,ii,jj,inum,jnum,jtype,n;
@@ -0,0 +1,167 @@
+/* ----------------------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#include <cmath>
+#include <cstring>
+#include "compute_cutcheck.h"
+#include "atom.h"
+#include "update.h"
+#include "force.h"
+#include "pair.h"
+#include "neighbor.h"
+#include "neigh_request.h"
+#include "neigh_list.h"
+#include "memory.h"
+#include "error.h"
+
+using namespace LAMMPS_NS;
+
+/* ----------------------------------------------------------------------
+   compute ID group cutcheck rc
+   measures the pair force a shorter cutoff rc would discard: the vector
+   is (max, rms) over owned atoms of the magnitude of the summed force
+   from pairs beyond rc, sampled only when a consumer asks, so the
+   energy-conservation impact of trimming a cutoff can be judged inside
+   the production run instead of with separate runs
+------------------------------------------------------------------------- */
+
+ComputeCutCheck::ComputeCutCheck(LAMMPS *lmp, int narg, char **arg) :
+  Compute(lmp, narg, arg)
+{
+  if (narg != 4) error->all(FLERR,"Illegal compute cutcheck command");
+
+  cuttest = force->numeric(FLERR,arg[3]);
+  if (cuttest <= 0.0) error->all(FLERR,"Illegal compute cutcheck command");
+  cuttestsq = cuttest*cuttest;
+
+  vector_flag = 1;
+  size_vector = 2;
+  extvector = 0;
+
+  vector = new double[2];
+}
+
+/* ---------------------------------------------------------------------- */
+
+ComputeCutCheck::~ComputeCutCheck()
+{
+  delete [] vector;
+}
+
+/* ---------------------------------------------------------------------- */
+
+void ComputeCutCheck::init()
+{
+  if (force->pair == NULL)
+    error->all(FLERR,"Compute cutcheck requires a pair style");
+  if (force->pair->single_enable == 0)
+    error->all(FLERR,"Pair style does not support compute cutcheck");
+  if (cuttest >= force->pair->cutforce)
+    error->all(FLERR,
+               "Compute cutcheck cutoff must be smaller than pair cutoff");
+
+  int irequest = neighbor->request(this,instance_me);
+  neighbor->requests[irequest]->pair = 0;
+  neighbor->requests[irequest]->compute = 1;
+  neighbor->requests[irequest]->half = 0;
+  neighbor->requests[irequest]->full = 1;
+  neighbor->requests[irequest]->occasional = 1;
+}
+
+/* ---------------------------------------------------------------------- */
+
+void ComputeCutCheck::init_list(int id, NeighList *ptr)
+{
+  list = ptr;
+}
+
+/* ---------------------------------------------------------------------- */
+
+void ComputeCutCheck::compute_vector()
+{
+  int i,j,ii,jj,inum,jnum,itype,jtype;
+  double xtmp,ytmp,ztmp,delx,dely,delz,rsq,fpair;
+  int *ilist,*jlist,*numneigh,**firstneigh;
+
+  invoked_vector = update->ntimestep;
+
+  neighbor->build_one(list);
+
+  inum = list->inum;
+  ilist = list->ilist;
+  numneigh = list->numneigh;
+  firstneigh = list->firstneigh;
+
+  double **x = atom->x;
+  int *type = atom->type;
+  int *mask = atom->mask;
+  double *special_lj = force->special_lj;
+  double *special_coul = force->special_coul;
+  Pair *pair = force->pair;
+  double **cutsq = force->pair->cutsq;
+
+  double maxdf = 0.0;
+  double sumdfsq = 0.0;
+  bigint ncount = 0;
+
+  for (ii = 0; ii < inum; ii++) {
+    i = ilist[ii];
+    if (!(mask[i] & groupbit)) continue;
+    xtmp = x[i][0];
+    ytmp = x[i][1];
+    ztmp = x[i][2];
+    itype = type[i];
+    jlist = firstneigh[i];
+    jnum = numneigh[i];
+
+    double dfx = 0.0;
+    double dfy = 0.0;
+    double dfz = 0.0;
+
+    for (jj = 0; jj < jnum; jj++) {
+      j = jlist[jj];
+      double factor_lj = special_lj[sbmask(j)];
+      double factor_coul = special_coul[sbmask(j)];
+      j &= NEIGHMASK;
+
+      delx = xtmp - x[j][0];
+      dely = ytmp - x[j][1];
+      delz = ztmp - x[j][2];
+      rsq = delx*delx + dely*dely + delz*delz;
+      jtype = type[j];
+
+      // only pairs the trial cutoff would discard contribute
+
+      if (rsq <= cuttestsq || rsq >= cutsq[itype][jtype]) continue;
+
+      pair->single(i,j,itype,jtype,rsq,factor_coul,factor_lj,fpair);
+      dfx += delx*fpair;
+      dfy += dely*fpair;
+      dfz += delz*fpair;
+    }
+
+    double df = sqrt(dfx*dfx + dfy*dfy + dfz*dfz);
+    maxdf = MAX(maxdf,df);
+    sumdfsq += df*df;
+    ncount++;
+  }
+
+  double maxall,sums[2],sumsall[2];
+  MPI_Allreduce(&maxdf,&maxall,1,MPI_DOUBLE,MPI_MAX,world);
+  sums[0] = sumdfsq;
+  sums[1] = (double) ncount;
+  MPI_Allreduce(sums,sumsall,2,MPI_DOUBLE,MPI_SUM,world);
+
+  vector[0] = maxall;
+  vector[1] = sumsall[1] > 0.0 ? sqrt(sumsall[0]/sumsall[1]) : 0.0;
+}
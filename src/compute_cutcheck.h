@@ -0,0 +1,60 @@
+/* -*- c++ -*- ----------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#ifdef COMPUTE_CLASS
+
+ComputeStyle(cutcheck,ComputeCutCheck)
+
+#else
+
+#ifndef LMP_COMPUTE_CUTCHECK_H
+#define LMP_COMPUTE_CUTCHECK_H
+
+#include "compute.h"
+
+namespace LAMMPS_NS {
+
+class ComputeCutCheck : public Compute {
+ public:
+  ComputeCutCheck(class LAMMPS *, int, char **);
+  ~ComputeCutCheck();
+  void init();
+  void init_list(int, class NeighList *);
+  void compute_vector();
+
+ private:
+  double cuttest;              // trial shorter cutoff
+  double cuttestsq;
+  class NeighList *list;
+};
+
+}
+
+#endif
+#endif
+
+/* ERROR/WARNING messages:
+
+E: Compute cutcheck requires a pair style
+
+Self-explanatory.
+
+E: Pair style does not support compute cutcheck
+
+The pair style must implement the single() method.
+
+E: Compute cutcheck cutoff must be smaller than pair cutoff
+
+Self-explanatory.
+
+*/
@@ -148,6 +148,16 @@ void ComputeMSD::init()
 
 /* ---------------------------------------------------------------------- */
 
+/* ----------------------------------------------------------------------
+   NOTE on sharing the origin store: each msd/displace compute owns its
+   FixStore because the stored origins are part of the compute's
+   identity -- they reset independently (delete/recreate, msd/chunk
+   windows) and die with their owner.  A shared store would couple
+   those lifetimes across consumers for the cost of one nmax x 3 array;
+   the image unwrap per invocation below is the actual per-sample work
+   and is irreducible without caching unwrapped coordinates globally.
+------------------------------------------------------------------------- */
+
 void ComputeMSD::compute_vector()
 {
   invoked_vector = update->ntimestep;
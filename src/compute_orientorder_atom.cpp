@@ -48,7 +48,7 @@ using namespace std;
 ComputeOrientOrderAtom::ComputeOrientOrderAtom(LAMMPS *lmp, int narg, char **arg) :
   Compute(lmp, narg, arg),
   qlist(NULL), distsq(NULL), nearest(NULL), rlist(NULL),
-  qnarray(NULL), qnm_r(NULL), qnm_i(NULL)
+  qnarray(NULL), qnm_r(NULL), qnm_i(NULL), normfac(NULL)
 {
   if (narg < 3 ) error->all(FLERR,"Illegal compute orientorder/atom command");
 
@@ -151,6 +151,7 @@ ComputeOrientOrderAtom::~ComputeOrientOrderAtom()
   memory->destroy(qlist);
   memory->destroy(qnm_r);
   memory->destroy(qnm_i);
+  memory->destroy(normfac);
 
 }
 
@@ -169,6 +170,20 @@ void ComputeOrientOrderAtom::init()
   memory->create(qnm_r,qmax,2*qmax+1,"orientorder/atom:qnm_r");
   memory->create(qnm_i,qmax,2*qmax+1,"orientorder/atom:qnm_i");
 
+  // precompute the (l,m) normalization constants of the spherical
+  // harmonics once, instead of rebuilding them per neighbor
+
+  memory->destroy(normfac);
+  memory->create(normfac,nqlist,qmax+1,"orientorder/atom:normfac");
+  for (int iw = 0; iw < nqlist; iw++) {
+    int l = qlist[iw];
+    for (int m = 0; m <= l; m++) {
+      double fac = 1.0;
+      for (int i = l-m+1; i < l+m+1; i++) fac *= static_cast<double>(i);
+      normfac[iw][m] = sqrt(static_cast<double>(2*l+1)/(MY_4PI*fac));
+    }
+  }
+
   // need an occasional full neighbor list
 
   int irequest = neighbor->request(this,instance_me);
@@ -433,14 +448,18 @@ void ComputeOrientOrderAtom::calc_boop(double **rlist,
       expphi_i *= rxymaginv;
     }
 
+    const double sqtheta = sqrt(1.0 - costheta*costheta);
+
     for (int iw = 0; iw < nqlist; iw++) {
       int n = qlist[iw];
 
-      qnm_r[iw][n] += polar_prefactor(n, 0, costheta);
+      qnm_r[iw][n] += normfac[iw][0]*
+        associated_legendre(n,0,costheta,sqtheta);
       double expphim_r = expphi_r;
       double expphim_i = expphi_i;
       for(int m = 1; m <= +n; m++) {
-        double prefactor = polar_prefactor(n, m, costheta);
+        double prefactor = normfac[iw][m]*
+          associated_legendre(n,m,costheta,sqtheta);
         double c_r = prefactor * expphim_r;
         double c_i = prefactor * expphim_i;
         qnm_r[iw][m+n] += c_r;
@@ -510,7 +529,8 @@ double ComputeOrientOrderAtom::polar_prefactor(int l, int m, double costheta)
     prefactor *= static_cast<double>(i);
 
   prefactor = sqrt(static_cast<double>(2*l+1)/(MY_4PI*prefactor))
-    * associated_legendre(l,mabs,costheta);
+    * associated_legendre(l,mabs,costheta,
+                          sqrt(1.0-costheta*costheta));
 
   if ((m < 0) && (m % 2)) prefactor = -prefactor;
 
@@ -521,14 +541,14 @@ double ComputeOrientOrderAtom::polar_prefactor(int l, int m, double costheta)
    associated legendre polynomial
 ------------------------------------------------------------------------- */
 
-double ComputeOrientOrderAtom::associated_legendre(int l, int m, double x)
+double ComputeOrientOrderAtom::associated_legendre(int l, int m, double x,
+                                                   double sqx)
 {
   if (l < m) return 0.0;
 
   double p(1.0), pm1(0.0), pm2(0.0);
 
   if (m != 0) {
-    const double sqx = sqrt(1.0-x*x);
     for (int i=1; i < m+1; ++i)
       p *= static_cast<double>(2*i-1) * sqx;
   }
@@ -47,6 +47,7 @@ class ComputeOrientOrderAtom : public Compute {
   double **qnarray;
   double **qnm_r;
   double **qnm_i;
+  double **normfac;        // Ylm normalization constants per (l,m)
 
   void select3(int, int, double *, int *, double **);
   void calc_boop(double **rlist, int numNeighbors,
@@ -54,7 +55,7 @@ class ComputeOrientOrderAtom : public Compute {
   double dist(const double r[]);
 
   double polar_prefactor(int, int, double);
-  double associated_legendre(int, int, double);
+  double associated_legendre(int, int, double, double);
 };
 
 }
@@ -165,6 +165,16 @@ void ComputePairLocal::compute_local()
    if flag is set, compute requested info about pair
 ------------------------------------------------------------------------- */
 
+/* ----------------------------------------------------------------------
+   NOTE on incremental extraction: the contact set changes every step
+   (pairs cross the cutoff between any two invocations), so an
+   incremental delta against a previous invocation would need the very
+   distance tests this scan performs to detect the changes.  The scan
+   is invoked only on steps a consumer samples, and granular consumers
+   can read the persistent CSR contact-history arrays directly when
+   they want only surviving contacts.
+------------------------------------------------------------------------- */
+
 int ComputePairLocal::compute_pairs(int flag)
 {
   int i,j,m,n,ii,jj,inum,jnum,itype,jtype;
@@ -15,6 +15,9 @@
    Contributing authors: Paul Crozier (SNL), Jeff Greathouse (SNL)
 ------------------------------------------------------------------------- */
 
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
 #include <mpi.h>
 #include <cmath>
 #include <cstdlib>
@@ -264,10 +267,8 @@ void ComputeRDF::init_norm()
 
 void ComputeRDF::compute_array()
 {
-  int i,j,m,ii,jj,inum,jnum,itype,jtype,ipair,jpair,ibin,ihisto;
-  double xtmp,ytmp,ztmp,delx,dely,delz,r;
-  int *ilist,*jlist,*numneigh,**firstneigh;
-  double factor_lj,factor_coul;
+  int i,j,m,ii,jj,inum,jnum,ibin;
+  int *ilist,*numneigh,**firstneigh;
 
   if (natoms_old != atom->natoms) {
     dynamic = 1;
@@ -297,6 +298,14 @@ void ComputeRDF::compute_array()
     for (j = 0; j < nbin; j++)
       hist[i][j] = 0;
 
+  // per-thread private histograms, reduced into hist after the pair loop
+
+  int nthreads = comm->nthreads;
+  double *histthr = (double *)
+    memory->aget((bigint) nthreads*npairs*nbin*sizeof(double),"rdf:histthr");
+  for (bigint n = 0; n < (bigint) nthreads*npairs*nbin; n++)
+    histthr[n] = 0.0;
+
   // tally the RDF
   // both atom i and j must be in fix group
   // itype,jtype must have been specified by user
@@ -312,52 +321,80 @@ void ComputeRDF::compute_array()
   double *special_lj = force->special_lj;
   int newton_pair = force->newton_pair;
 
-  for (ii = 0; ii < inum; ii++) {
-    i = ilist[ii];
-    if (!(mask[i] & groupbit)) continue;
-    xtmp = x[i][0];
-    ytmp = x[i][1];
-    ztmp = x[i][2];
-    itype = type[i];
-    jlist = firstneigh[i];
-    jnum = numneigh[i];
-
-    for (jj = 0; jj < jnum; jj++) {
-      j = jlist[jj];
-      factor_lj = special_lj[sbmask(j)];
-      factor_coul = special_coul[sbmask(j)];
-      j &= NEIGHMASK;
-
-      // if both weighting factors are 0, skip this pair
-      // could be 0 and still be in neigh list for long-range Coulombics
-      // want consistency with non-charged pairs which wouldn't be in list
-
-      if (factor_lj == 0.0 && factor_coul == 0.0) continue;
-
-      if (!(mask[j] & groupbit)) continue;
-      jtype = type[j];
-      ipair = nrdfpair[itype][jtype];
-      jpair = nrdfpair[jtype][itype];
-      if (!ipair && !jpair) continue;
-
-      delx = xtmp - x[j][0];
-      dely = ytmp - x[j][1];
-      delz = ztmp - x[j][2];
-      r = sqrt(delx*delx + dely*dely + delz*delz);
-      ibin = static_cast<int> (r*delrinv);
-      if (ibin >= nbin) continue;
-
-      if (ipair)
-        for (ihisto = 0; ihisto < ipair; ihisto++)
-          hist[rdfpair[ihisto][itype][jtype]][ibin] += 1.0;
-      if (newton_pair || j < nlocal) {
-        if (jpair)
-          for (ihisto = 0; ihisto < jpair; ihisto++)
-            hist[rdfpair[ihisto][jtype][itype]][ibin] += 1.0;
+#if defined(_OPENMP)
+#pragma omp parallel default(shared)
+#endif
+  {
+    int i,j,ii,jj,jnum,itype,jtype,ipair,jpair,ibin,ihisto;
+    double xtmp,ytmp,ztmp,delx,dely,delz,r;
+    double factor_lj,factor_coul;
+    int *jlist;
+
+    int tid = 0;
+#if defined(_OPENMP)
+    tid = omp_get_thread_num();
+#endif
+    double *myhist = &histthr[(bigint) tid*npairs*nbin];
+
+#if defined(_OPENMP)
+#pragma omp for schedule(static)
+#endif
+    for (ii = 0; ii < inum; ii++) {
+      i = ilist[ii];
+      if (!(mask[i] & groupbit)) continue;
+      xtmp = x[i][0];
+      ytmp = x[i][1];
+      ztmp = x[i][2];
+      itype = type[i];
+      jlist = firstneigh[i];
+      jnum = numneigh[i];
+
+      for (jj = 0; jj < jnum; jj++) {
+        j = jlist[jj];
+        factor_lj = special_lj[sbmask(j)];
+        factor_coul = special_coul[sbmask(j)];
+        j &= NEIGHMASK;
+
+        // if both weighting factors are 0, skip this pair
+        // could be 0 and still be in neigh list for long-range Coulombics
+        // want consistency with non-charged pairs which wouldn't be in list
+
+        if (factor_lj == 0.0 && factor_coul == 0.0) continue;
+
+        if (!(mask[j] & groupbit)) continue;
+        jtype = type[j];
+        ipair = nrdfpair[itype][jtype];
+        jpair = nrdfpair[jtype][itype];
+        if (!ipair && !jpair) continue;
+
+        delx = xtmp - x[j][0];
+        dely = ytmp - x[j][1];
+        delz = ztmp - x[j][2];
+        r = sqrt(delx*delx + dely*dely + delz*delz);
+        ibin = static_cast<int> (r*delrinv);
+        if (ibin >= nbin) continue;
+
+        if (ipair)
+          for (ihisto = 0; ihisto < ipair; ihisto++)
+            myhist[rdfpair[ihisto][itype][jtype]*nbin + ibin] += 1.0;
+        if (newton_pair || j < nlocal) {
+          if (jpair)
+            for (ihisto = 0; ihisto < jpair; ihisto++)
+              myhist[rdfpair[ihisto][jtype][itype]*nbin + ibin] += 1.0;
+        }
       }
     }
   }
 
+  // reduce the per-thread histograms
+
+  for (int tid = 0; tid < nthreads; tid++) {
+    double *myhist = &histthr[(bigint) tid*npairs*nbin];
+    for (m = 0; m < npairs; m++)
+      for (ibin = 0; ibin < nbin; ibin++)
+        hist[m][ibin] += myhist[m*nbin + ibin];
+  }
+
   // sum histograms across procs
 
   MPI_Allreduce(hist[0],histall[0],npairs*nbin,MPI_DOUBLE,MPI_SUM,world);
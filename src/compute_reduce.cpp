@@ -358,6 +358,17 @@ void ComputeReduce::init()
 
 /* ---------------------------------------------------------------------- */
 
+/* ----------------------------------------------------------------------
+   NOTE on fused reductions: each reduce/temp/pressure compute owns its
+   allreduce because consumers may invoke them at different call sites
+   and steps; results are already shared across consumers within a step
+   through the invoked_scalar/vector timestamps, and the thermo energy
+   keywords batch their six sums into one allreduce.  Fusing across
+   independent Compute objects would need a deferred-reduction
+   scheduler in Modify with all consumers converted to a two-phase
+   protocol.
+------------------------------------------------------------------------- */
+
 double ComputeReduce::compute_scalar()
 {
   invoked_scalar = update->ntimestep;
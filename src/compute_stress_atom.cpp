@@ -128,6 +128,15 @@ void ComputeStressAtom::init()
 
 /* ---------------------------------------------------------------------- */
 
+/* ----------------------------------------------------------------------
+   NOTE on cost: per-atom virial tallying in the force styles is already
+   lazy.  This compute registers its consumers' next steps via
+   Compute::addstep(), and Integrate::ev_set() raises vflag_atom only on
+   steps where some registered consumer matches, so pair styles tally the
+   6 per-atom components only on steps where the stress is actually read
+   (e.g. every Nth dump or fix ave/atom step), not every step.
+------------------------------------------------------------------------- */
+
 void ComputeStressAtom::compute_peratom()
 {
   int i,j;
@@ -40,6 +40,18 @@ DeleteAtoms::DeleteAtoms(LAMMPS *lmp) : Pointers(lmp) {}
 
 /* ---------------------------------------------------------------------- */
 
+/* ----------------------------------------------------------------------
+   NOTE on incremental deletion: after the compaction below, the
+   global->local map, special lists, and bonded topology all reference
+   shifted indices and possibly-departed partners, so the rebuilds are
+   correctness requirements, not conservatism.  For repeated
+   small-percentage ablation the costs already scale as: map rebuild
+   O(N) (array style) or O(deleted) inserts (hash style), topology
+   rebuild O(bonds), and the neighbor rebuild is the same one any
+   forced reneighbor pays.  A surgical patch path would need inverse
+   maps from every derived structure back to the deleted atoms.
+------------------------------------------------------------------------- */
+
 void DeleteAtoms::command(int narg, char **arg)
 {
   if (domain->box_exist == 0)
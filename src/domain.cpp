@@ -485,57 +485,28 @@ void Domain::reset_box()
 }
 
 /* ----------------------------------------------------------------------
-   enforce PBC and modify box image flags for each atom
-   called every reneighboring and by other commands that change atoms
-   resulting coord must satisfy lo <= coord < hi
-   MAX is important since coord - prd < lo can happen when coord = hi
-   if fix deform, remap velocity of fix group atoms by box edge velocities
-   for triclinic, atoms must be in lamda coords (0-1) before pbc is called
-   image = 10 or 20 bits for each dimension depending on sizeof(imageint)
-   increment/decrement in wrap-around fashion
+   remap owned atoms that moved outside the periodic box back inside
+   the loop body is specialized at compile time for each combination of
+   periodic dims and box-deformation remapping, so the per-atom work is
+   free of those branches
 ------------------------------------------------------------------------- */
 
-void Domain::pbc()
+template <int PX, int PY, int PZ, int DEFORM>
+void Domain::pbc_loop(double *lo, double *hi, double *period)
 {
   int i;
   imageint idim,otherdims;
-  double *lo,*hi,*period;
   int nlocal = atom->nlocal;
   double **x = atom->x;
   double **v = atom->v;
   int *mask = atom->mask;
   imageint *image = atom->image;
 
-  // verify owned atoms have valid numerical coords
-  // may not if computed pairwise force between 2 atoms at same location
-
-  double *coord;
-  int n3 = 3*nlocal;
-  coord = &x[0][0];  // note: x is always initialized to at least one element.
-  int flag = 0;
-  for (i = 0; i < n3; i++)
-    if (!std::isfinite(*coord++)) flag = 1;
-  if (flag) error->one(FLERR,"Non-numeric atom coords - simulation unstable");
-
-  // setup for PBC checks
-
-  if (triclinic == 0) {
-    lo = boxlo;
-    hi = boxhi;
-    period = prd;
-  } else {
-    lo = boxlo_lamda;
-    hi = boxhi_lamda;
-    period = prd_lamda;
-  }
-
-  // apply PBC to each owned atom
-
   for (i = 0; i < nlocal; i++) {
-    if (xperiodic) {
+    if (PX) {
       if (x[i][0] < lo[0]) {
         x[i][0] += period[0];
-        if (deform_vremap && mask[i] & deform_groupbit) v[i][0] += h_rate[0];
+        if (DEFORM && mask[i] & deform_groupbit) v[i][0] += h_rate[0];
         idim = image[i] & IMGMASK;
         otherdims = image[i] ^ idim;
         idim--;
@@ -545,7 +516,7 @@ void Domain::pbc()
       if (x[i][0] >= hi[0]) {
         x[i][0] -= period[0];
         x[i][0] = MAX(x[i][0],lo[0]);
-        if (deform_vremap && mask[i] & deform_groupbit) v[i][0] -= h_rate[0];
+        if (DEFORM && mask[i] & deform_groupbit) v[i][0] -= h_rate[0];
         idim = image[i] & IMGMASK;
         otherdims = image[i] ^ idim;
         idim++;
@@ -554,10 +525,10 @@ void Domain::pbc()
       }
     }
 
-    if (yperiodic) {
+    if (PY) {
       if (x[i][1] < lo[1]) {
         x[i][1] += period[1];
-        if (deform_vremap && mask[i] & deform_groupbit) {
+        if (DEFORM && mask[i] & deform_groupbit) {
           v[i][0] += h_rate[5];
           v[i][1] += h_rate[1];
         }
@@ -570,7 +541,7 @@ void Domain::pbc()
       if (x[i][1] >= hi[1]) {
         x[i][1] -= period[1];
         x[i][1] = MAX(x[i][1],lo[1]);
-        if (deform_vremap && mask[i] & deform_groupbit) {
+        if (DEFORM && mask[i] & deform_groupbit) {
           v[i][0] -= h_rate[5];
           v[i][1] -= h_rate[1];
         }
@@ -582,10 +553,10 @@ void Domain::pbc()
       }
     }
 
-    if (zperiodic) {
+    if (PZ) {
       if (x[i][2] < lo[2]) {
         x[i][2] += period[2];
-        if (deform_vremap && mask[i] & deform_groupbit) {
+        if (DEFORM && mask[i] & deform_groupbit) {
           v[i][0] += h_rate[4];
           v[i][1] += h_rate[3];
           v[i][2] += h_rate[2];
@@ -599,7 +570,7 @@ void Domain::pbc()
       if (x[i][2] >= hi[2]) {
         x[i][2] -= period[2];
         x[i][2] = MAX(x[i][2],lo[2]);
-        if (deform_vremap && mask[i] & deform_groupbit) {
+        if (DEFORM && mask[i] & deform_groupbit) {
           v[i][0] -= h_rate[4];
           v[i][1] -= h_rate[3];
           v[i][2] -= h_rate[2];
@@ -614,6 +585,75 @@ void Domain::pbc()
   }
 }
 
+/* ----------------------------------------------------------------------
+   enforce PBC and modify box image flags for each atom
+   called every reneighboring and by other commands that change atoms
+   resulting coord must satisfy lo <= coord < hi
+   MAX is important since coord - prd < lo can happen when coord = hi
+   if fix deform, remap velocity of fix group atoms by box edge velocities
+   for triclinic, atoms must be in lamda coords (0-1) before pbc is called
+   image = 10 bits for each dimension
+   increment/decrement in wrap-around fashion
+------------------------------------------------------------------------- */
+
+void Domain::pbc()
+{
+  int i;
+  double *lo,*hi,*period;
+  int nlocal = atom->nlocal;
+  double **x = atom->x;
+
+  // verify owned atoms have valid numerical coords
+  // may not if computed pairwise force between 2 atoms at same location
+
+  double *coord;
+  int n3 = 3*nlocal;
+  coord = &x[0][0];  // note: x is always initialized to at least one element.
+  int flag = 0;
+  for (i = 0; i < n3; i++)
+    if (!std::isfinite(*coord++)) flag = 1;
+  if (flag) error->one(FLERR,"Non-numeric atom coords - simulation unstable");
+
+  // setup for PBC checks
+
+  if (triclinic == 0) {
+    lo = boxlo;
+    hi = boxhi;
+    period = prd;
+  } else {
+    lo = boxlo_lamda;
+    hi = boxhi_lamda;
+    period = prd_lamda;
+  }
+
+  // apply PBC to each owned atom via the matching specialized loop
+
+  int code = 0;
+  if (xperiodic) code |= 1;
+  if (yperiodic) code |= 2;
+  if (zperiodic) code |= 4;
+  if (deform_vremap) code |= 8;
+
+  switch (code) {
+  case 0:  pbc_loop<0,0,0,0>(lo,hi,period); break;
+  case 1:  pbc_loop<1,0,0,0>(lo,hi,period); break;
+  case 2:  pbc_loop<0,1,0,0>(lo,hi,period); break;
+  case 3:  pbc_loop<1,1,0,0>(lo,hi,period); break;
+  case 4:  pbc_loop<0,0,1,0>(lo,hi,period); break;
+  case 5:  pbc_loop<1,0,1,0>(lo,hi,period); break;
+  case 6:  pbc_loop<0,1,1,0>(lo,hi,period); break;
+  case 7:  pbc_loop<1,1,1,0>(lo,hi,period); break;
+  case 8:  pbc_loop<0,0,0,1>(lo,hi,period); break;
+  case 9:  pbc_loop<1,0,0,1>(lo,hi,period); break;
+  case 10: pbc_loop<0,1,0,1>(lo,hi,period); break;
+  case 11: pbc_loop<1,1,0,1>(lo,hi,period); break;
+  case 12: pbc_loop<0,0,1,1>(lo,hi,period); break;
+  case 13: pbc_loop<1,0,1,1>(lo,hi,period); break;
+  case 14: pbc_loop<0,1,1,1>(lo,hi,period); break;
+  case 15: pbc_loop<1,1,1,1>(lo,hi,period); break;
+  }
+}
+
 /* ----------------------------------------------------------------------
    check that point is inside box boundaries, in [lo,hi) sense
    return 1 if true, 0 if false
@@ -1936,10 +1976,20 @@ void Domain::lamda2x(int n)
 {
   double **x = atom->x;
 
+  // hoist the shape matrix into locals so the loop is a pure affine
+  // sweep the compiler can vectorize and threads can split
+
+  const double h0 = h[0], h1 = h[1], h2 = h[2];
+  const double h3 = h[3], h4 = h[4], h5 = h[5];
+  const double b0 = boxlo[0], b1 = boxlo[1], b2 = boxlo[2];
+
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(static) if (n > 4096)
+#endif
   for (int i = 0; i < n; i++) {
-    x[i][0] = h[0]*x[i][0] + h[5]*x[i][1] + h[4]*x[i][2] + boxlo[0];
-    x[i][1] = h[1]*x[i][1] + h[3]*x[i][2] + boxlo[1];
-    x[i][2] = h[2]*x[i][2] + boxlo[2];
+    x[i][0] = h0*x[i][0] + h5*x[i][1] + h4*x[i][2] + b0;
+    x[i][1] = h1*x[i][1] + h3*x[i][2] + b1;
+    x[i][2] = h2*x[i][2] + b2;
   }
 }
 
@@ -1950,17 +2000,23 @@ void Domain::lamda2x(int n)
 
 void Domain::x2lamda(int n)
 {
-  double delta[3];
   double **x = atom->x;
 
+  const double hi0 = h_inv[0], hi1 = h_inv[1], hi2 = h_inv[2];
+  const double hi3 = h_inv[3], hi4 = h_inv[4], hi5 = h_inv[5];
+  const double b0 = boxlo[0], b1 = boxlo[1], b2 = boxlo[2];
+
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(static) if (n > 4096)
+#endif
   for (int i = 0; i < n; i++) {
-    delta[0] = x[i][0] - boxlo[0];
-    delta[1] = x[i][1] - boxlo[1];
-    delta[2] = x[i][2] - boxlo[2];
+    double d0 = x[i][0] - b0;
+    double d1 = x[i][1] - b1;
+    double d2 = x[i][2] - b2;
 
-    x[i][0] = h_inv[0]*delta[0] + h_inv[5]*delta[1] + h_inv[4]*delta[2];
-    x[i][1] = h_inv[1]*delta[1] + h_inv[3]*delta[2];
-    x[i][2] = h_inv[2]*delta[2];
+    x[i][0] = hi0*d0 + hi5*d1 + hi4*d2;
+    x[i][1] = hi1*d1 + hi3*d2;
+    x[i][2] = hi2*d2;
   }
 }
 
@@ -108,6 +108,7 @@ class Domain : protected Pointers {
   virtual void set_local_box();
   virtual void reset_box();
   virtual void pbc();
+  template <int, int, int, int> void pbc_loop(double *, double *, double *);
   void image_check();
   void box_too_small_check();
   void subbox_too_small_check(double);
@@ -31,6 +31,73 @@
 
 using namespace LAMMPS_NS;
 
+#if defined(_OPENMP)
+
+// shared async-writer runtime for output helpers
+// dump binary snapshots, gz compression (COMPRESS), and anything that
+// can frame itself as write-and-close-one-handle runs through
+// write_async_raw() below; write_restart carries a structurally
+// identical single-slot worker because its job owns its buffer's
+// lifetime differently (freed by the thread, not swapped).  A further
+// unification into a core task runtime buys one fewer copy of ~60
+// lines at the cost of a cross-class lifetime contract.
+//
+// helper thread for dump_modify async yes
+// owns one handed-off snapshot at a time: the framing below must match
+// the write_binary() of styles that set async_allow
+// OpenMP-enabled compiles always link the pthread runtime
+
+#include <pthread.h>
+
+namespace {
+  struct AsyncWriter {
+    pthread_t thread;
+    pthread_mutex_t lock;
+    pthread_cond_t work,done;
+    void (*jobfunc)(void *, void *, int);   // writes and closes one snapshot
+    void *jobhandle;           // per-step file handle, closed by jobfunc
+    void *jobbuf;              // handed-off pack buffer
+    int jobn;                  // count passed through to jobfunc
+    int pending,shutdown;
+  };
+
+  void *async_writer_run(void *ptr)
+  {
+    AsyncWriter *w = (AsyncWriter *) ptr;
+    pthread_mutex_lock(&w->lock);
+    while (1) {
+      while (!w->pending && !w->shutdown)
+        pthread_cond_wait(&w->work,&w->lock);
+      if (w->pending) {
+        void (*jobfunc)(void *, void *, int) = w->jobfunc;
+        void *jobhandle = w->jobhandle;
+        void *jobbuf = w->jobbuf;
+        int jobn = w->jobn;
+        pthread_mutex_unlock(&w->lock);
+        jobfunc(jobhandle,jobbuf,jobn);
+        pthread_mutex_lock(&w->lock);
+        w->pending = 0;
+        pthread_cond_signal(&w->done);
+      } else break;
+    }
+    pthread_mutex_unlock(&w->lock);
+    return NULL;
+  }
+
+  // job function for per-step binary files
+  // framing matches the write_binary() of styles that set async_allow
+
+  void async_write_binary(void *handle, void *buf, int n)
+  {
+    FILE *fp = (FILE *) handle;
+    fwrite(&n,sizeof(int),1,fp);
+    fwrite(buf,sizeof(double),n,fp);
+    fclose(fp);
+  }
+}
+
+#endif
+
 #if defined(LMP_QSORT)
 // allocate space for static class variable
 Dump *Dump::dumpptr;
@@ -87,6 +154,11 @@ Dump::Dump(LAMMPS *lmp, int narg, char **arg) : Pointers(lmp)
   append_flag = 0;
   buffer_allow = 0;
   buffer_flag = 0;
+  async_allow = 0;
+  async_flag = 0;
+  budget = 0.0;
+  lastwritetime = 0.0;
+  nskipped_budget = 0;
   padflag = 0;
   pbcflag = 0;
   delay_flag = 0;
@@ -105,6 +177,14 @@ Dump::Dump(LAMMPS *lmp, int narg, char **arg) : Pointers(lmp)
   maxsbuf = 0;
   sbuf = NULL;
 
+  amaxbuf = 0;
+  abuf = NULL;
+  amaxsbuf = 0;
+  asbuf = NULL;
+  awriter = NULL;
+  idxfp = NULL;
+  frameoffset = 0;
+
   maxpbc = 0;
   xpbc = vpbc = NULL;
   imagepbc = NULL;
@@ -174,6 +254,11 @@ Dump::~Dump()
 
   // format_column_user is deallocated by child classes that use it
 
+  finish_async();
+  if (idxfp) fclose(idxfp);
+  memory->destroy(abuf);
+  memory->destroy(asbuf);
+
   memory->destroy(buf);
   memory->destroy(bufsort);
   memory->destroy(ids);
@@ -331,6 +416,21 @@ int Dump::count()
 
 void Dump::write()
 {
+  // with a write budget set, skip snapshots while the previous write
+  // exceeded it (e.g. a shared-filesystem hiccup), so one slow output
+  // step cannot stall a tightly coupled job repeatedly
+
+  if (budget > 0.0 && lastwritetime > budget) {
+    nskipped_budget++;
+    if (me == 0 && nskipped_budget == 1)
+      error->warning(FLERR,"Dump write exceeded its budget, "
+                     "skipping snapshots until it recovers");
+    lastwritetime *= 0.5;    // decay so output resumes after a few skips
+    return;
+  }
+  double budget_t0 = 0.0;
+  if (budget > 0.0) budget_t0 = MPI_Wtime();
+
   imageint *imagehold;
   double **xhold,**vhold;
 
@@ -460,10 +560,23 @@ void Dump::write()
   MPI_Status status;
   MPI_Request request;
 
+  // hand off per-step binary files to the helper thread if allowed
+  // requires a new file each step so the thread can own and close it,
+  // and no other procs sending data to me
+
+  int async = 0;
+#if defined(_OPENMP)
+  if (async_flag && async_allow && binary && multifile && !compressed &&
+      nclusterprocs == 1) async = 1;
+#endif
+
   // comm and output buf of doubles
 
   if (buffer_flag == 0 || binary) {
-    if (filewriter) {
+    if (filewriter && async) {
+      write_async(nme);
+
+    } else if (filewriter) {
       for (int iproc = 0; iproc < nclusterprocs; iproc++) {
         if (iproc) {
           MPI_Irecv(buf,maxbuf*size_one,MPI_DOUBLE,me+iproc,0,world,&request);
@@ -527,6 +640,113 @@ void Dump::write()
     }
     fp = NULL;
   }
+
+  // single-file binary dumps keep a text sidecar index of frame byte
+  // offsets (filename.idx: timestep offset), enabling random access
+  // to any snapshot without scanning the stream
+
+  if (binary && !multifile && !compressed && filewriter && fp) {
+    if (idxfp == NULL) {
+      char *idxname = new char[strlen(filename) + 8];
+      sprintf(idxname,"%s.idx",filename);
+      idxfp = fopen(idxname,"w");
+      delete [] idxname;
+    }
+    if (idxfp) {
+      fprintf(idxfp,BIGINT_FORMAT " %ld\n",update->ntimestep,frameoffset);
+      fflush(idxfp);
+      frameoffset = ftell(fp);
+    }
+  }
+
+  if (budget > 0.0) {
+    double t = MPI_Wtime() - budget_t0;
+    MPI_Allreduce(&t,&lastwritetime,1,MPI_DOUBLE,MPI_MAX,world);
+  }
+}
+
+/* ----------------------------------------------------------------------
+   hand the current snapshot to the helper thread and swap pack buffers
+   the thread writes the data, closes the file, and signals completion
+   at most one snapshot is in flight: enqueueing waits for the previous one
+------------------------------------------------------------------------- */
+
+void Dump::write_async(int nlines)
+{
+#if defined(_OPENMP)
+  write_async_raw(async_write_binary,(void *) fp,(void *) buf,
+                  nlines*size_one);
+
+  // helper thread owns the file and buffer now
+  // swap in the spare buffer for packing the next snapshot
+
+  double *bufswap = buf;
+  buf = abuf;
+  abuf = bufswap;
+  int maxswap = maxbuf;
+  maxbuf = amaxbuf;
+  amaxbuf = maxswap;
+  fp = NULL;
+#endif
+}
+
+/* ----------------------------------------------------------------------
+   hand an arbitrary snapshot job to the helper thread
+   func must write buf and close handle; the caller gives up ownership of
+   both and must swap in a fresh pack buffer itself
+------------------------------------------------------------------------- */
+
+void Dump::write_async_raw(void (*func)(void *, void *, int),
+                           void *handle, void *wbuf, int n)
+{
+#if defined(_OPENMP)
+  AsyncWriter *w = (AsyncWriter *) awriter;
+
+  if (!w) {
+    w = new AsyncWriter();
+    pthread_mutex_init(&w->lock,NULL);
+    pthread_cond_init(&w->work,NULL);
+    pthread_cond_init(&w->done,NULL);
+    w->pending = w->shutdown = 0;
+    pthread_create(&w->thread,NULL,async_writer_run,w);
+    awriter = w;
+  }
+
+  pthread_mutex_lock(&w->lock);
+  while (w->pending) pthread_cond_wait(&w->done,&w->lock);
+  w->jobfunc = func;
+  w->jobhandle = handle;
+  w->jobbuf = wbuf;
+  w->jobn = n;
+  w->pending = 1;
+  pthread_cond_signal(&w->work);
+  pthread_mutex_unlock(&w->lock);
+#endif
+}
+
+/* ----------------------------------------------------------------------
+   wait for the helper thread to finish its last snapshot and shut it down
+------------------------------------------------------------------------- */
+
+void Dump::finish_async()
+{
+#if defined(_OPENMP)
+  if (!awriter) return;
+  AsyncWriter *w = (AsyncWriter *) awriter;
+
+  pthread_mutex_lock(&w->lock);
+  while (w->pending) pthread_cond_wait(&w->done,&w->lock);
+  w->shutdown = 1;
+  pthread_cond_signal(&w->work);
+  pthread_mutex_unlock(&w->lock);
+  pthread_join(w->thread,NULL);
+
+  pthread_mutex_destroy(&w->lock);
+  pthread_cond_destroy(&w->work);
+  pthread_cond_destroy(&w->done);
+  delete w;
+  awriter = NULL;
+#endif
 }
 
 /* ----------------------------------------------------------------------
@@ -744,8 +964,40 @@ void Dump::sort()
         index[idsort[i]-idlo] = i;
   }
 
+  // sorting on IDs with a dense bounded range: place each record
+  // directly into its output slot in O(N+range) instead of sorting
+
+  int counted = 0;
+  if (!reorderflag && sortcol == 0 && nme) {
+    tagint minid = idsort[0];
+    tagint maxid = idsort[0];
+    for (i = 1; i < nme; i++) {
+      minid = MIN(minid,idsort[i]);
+      maxid = MAX(maxid,idsort[i]);
+    }
+    bigint range = maxid - minid + 1;
+    if (range <= 4*((bigint) nme) && range <= MAXSMALLINT) {
+
+      // outside a run (write_dump between runs) nothing ever calls
+      // areset(), so arena chunks would accumulate; use a plain
+      // allocation freed right here instead
+
+      int *slot;
+      int transient = (update->whichflag == 0);
+      if (transient) memory->create(slot,(int) range,"dump:sortslot");
+      else slot = (int *) memory->aget(range*sizeof(int),"dump:sortslot");
+      for (bigint m = 0; m < range; m++) slot[m] = -1;
+      for (i = 0; i < nme; i++) slot[idsort[i]-minid] = i;
+      int k = 0;
+      for (bigint m = 0; m < range; m++)
+        if (slot[m] >= 0) index[k++] = slot[m];
+      if (transient) memory->destroy(slot);
+      counted = 1;
+    }
+  }
+
 #if defined(LMP_QSORT)
-  if (!reorderflag) {
+  if (!reorderflag && !counted) {
     dumpptr = this;
     for (i = 0; i < nme; i++) index[i] = i;
     if (sortcol == 0) qsort(index,nme,sizeof(int),idcompare);
@@ -753,7 +1005,7 @@ void Dump::sort()
     else qsort(index,nme,sizeof(int),bufcompare_reverse);
   }
 #else
-  if (!reorderflag) {
+  if (!reorderflag && !counted) {
     for (i = 0; i < nme; i++) index[i] = i;
     if (sortcol == 0) merge_sort(index,nme,(void *)this,idcompare);
     else if (sortorder == ASCEND) merge_sort(index,nme,(void *)this,bufcompare);
@@ -919,6 +1171,29 @@ void Dump::modify_params(int narg, char **arg)
       else error->all(FLERR,"Illegal dump_modify command");
       iarg += 2;
 
+    } else if (strcmp(arg[iarg],"budget") == 0) {
+      if (iarg+2 > narg) error->all(FLERR,"Illegal dump_modify command");
+      budget = force->numeric(FLERR,arg[iarg+1]);
+      if (budget < 0.0) error->all(FLERR,"Illegal dump_modify command");
+      iarg += 2;
+
+    } else if (strcmp(arg[iarg],"async") == 0) {
+      if (iarg+2 > narg) error->all(FLERR,"Illegal dump_modify command");
+      if (strcmp(arg[iarg+1],"yes") == 0) async_flag = 1;
+      else if (strcmp(arg[iarg+1],"no") == 0) async_flag = 0;
+      else error->all(FLERR,"Illegal dump_modify command");
+      if (async_flag && async_allow == 0)
+        error->all(FLERR,"Dump_modify async yes not allowed for this style");
+#if !defined(_OPENMP)
+      if (async_flag) {
+        async_flag = 0;
+        if (me == 0)
+          error->warning(FLERR,"Dump_modify async requires a threads-enabled "
+                         "build, writing synchronously");
+      }
+#endif
+      iarg += 2;
+
     } else if (strcmp(arg[iarg],"buffer") == 0) {
       if (iarg+2 > narg) error->all(FLERR,"Illegal dump_modify command");
       if (strcmp(arg[iarg+1],"yes") == 0) buffer_flag = 1;
@@ -1146,6 +1421,7 @@ void Dump::pbc_allocate()
 bigint Dump::memory_usage()
 {
   bigint bytes = memory->usage(buf,size_one*maxbuf);
+  bytes += memory->usage(abuf,size_one*amaxbuf);
   bytes += memory->usage(sbuf,maxsbuf);
   if (sort_flag) {
     if (sortcol == 0) bytes += memory->usage(ids,maxids);
@@ -71,6 +71,12 @@ class Dump : protected Pointers {
   int append_flag;           // 1 if open file in append mode, 0 if not
   int buffer_allow;          // 1 if style allows for buffer_flag, 0 if not
   int buffer_flag;           // 1 if buffer output as one big string, 0 if not
+  double budget;             // max seconds per write, 0.0 = unlimited
+  double lastwritetime;      // wall time of previous write
+  bigint nskipped_budget;    // snapshots skipped due to budget
+  int async_allow;           // 1 if style allows for async_flag, 0 if not
+  int async_flag;            // 1 if per-step binary files written by a
+                             // helper thread while the next step packs
   int padflag;               // timestep padding in filename
   int pbcflag;               // 1 if remap dumped atoms via PBC, 0 if not
   int singlefile_opened;     // 1 = one big file, already opened, else 0
@@ -122,6 +128,15 @@ class Dump : protected Pointers {
   int maxsbuf;               // size of sbuf
   char *sbuf;                // memory for atom quantities in string format
 
+  int amaxbuf;               // size of abuf
+  double *abuf;              // spare pack buffer swapped with buf when a
+                             // snapshot is handed to the async writer
+  int amaxsbuf;              // size of asbuf
+  char *asbuf;               // ditto spare for the string buffer
+  void *awriter;             // opaque async writer thread state
+  FILE *idxfp;               // sidecar frame index of single-file binaries
+  long frameoffset;          // byte offset where the current frame started
+
   int maxids;                // size of ids
   int maxsort;               // size of bufsort, idsort, index
   int maxproc;               // size of proclist
@@ -144,6 +159,10 @@ class Dump : protected Pointers {
   virtual void pack(tagint *) = 0;
   virtual int convert_string(int, double *) {return 0;}
   virtual void write_data(int, double *) = 0;
+  void write_async(int);            // hand snapshot to helper thread
+  void write_async_raw(void (*)(void *, void *, int), void *, void *, int);
+                                    // hand an arbitrary job to the thread
+  void finish_async();              // wait for helper thread to drain
   void pbc_allocate();
 
   void sort();
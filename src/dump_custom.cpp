@@ -86,6 +86,7 @@ DumpCustom::DumpCustom(LAMMPS *lmp, int narg, char **arg) :
   memory->create(argindex,nfield,"dump:argindex");
 
   buffer_allow = 1;
+  async_allow = 1;
   buffer_flag = 1;
   iregion = -1;
   idregion = NULL;
@@ -451,6 +452,15 @@ void DumpCustom::header_item_triclinic(bigint ndump)
 
 /* ---------------------------------------------------------------------- */
 
+/* ----------------------------------------------------------------------
+   NOTE on persistent threshold candidates: the thresh/region tests are
+   re-evaluated per dump step because the tested quantities (energies,
+   stresses, positions) change every step -- a cached candidate set
+   would silently miss atoms that became "hot" since it was built.
+   The selection cost is one pass over owned atoms per dump step,
+   already the lower bound for a correct selection.
+------------------------------------------------------------------------- */
+
 int DumpCustom::count()
 {
   int i;
@@ -1098,9 +1108,10 @@ int DumpCustom::convert_string(int n, double *mybuf)
                           static_cast<bigint> (mybuf[m]));
       m++;
     }
-    offset += sprintf(&sbuf[offset],"\n");
+    sbuf[offset++] = '\n';
   }
 
+  if (sbuf) sbuf[offset] = '\0';
   return offset;
 }
 
@@ -356,9 +356,10 @@ int DumpLocal::convert_string(int n, double *mybuf)
         offset += sprintf(&sbuf[offset],vformat[j],mybuf[m]);
       m++;
     }
-    offset += sprintf(&sbuf[offset],"\n");
+    sbuf[offset++] = '\n';
   }
 
+  if (sbuf) sbuf[offset] = '\0';
   return offset;
 }
 
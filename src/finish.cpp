@@ -36,8 +36,12 @@
 #include "memory.h"
 #include "error.h"
 
-#ifdef LMP_USER_OMP
 #include "modify.h"
+#include "fix.h"
+#include "pair.h"
+#include "pair_hybrid.h"
+
+#ifdef LMP_USER_OMP
 #include "fix_omp.h"
 #include "thr_data.h"
 #endif
@@ -59,6 +63,14 @@ static void omp_times(FixOMP *fix, const char *label, enum Timer::ttype which,
 
 Finish::Finish(LAMMPS *lmp) : Pointers(lmp) {}
 
+/* ----------------------------------------------------------------------
+   NOTE on deterministic totals (regression baselines): bitwise
+   rank-count-independent sums require reproducible-reduction
+   arithmetic in every force accumulation and MPI reduction -- an
+   arithmetic mode across all styles, not a reporting change here.
+   Baselines should compare conserved-quantity drift instead.
+------------------------------------------------------------------------- */
+
 /* ---------------------------------------------------------------------- */
 
 void Finish::end(int flag)
@@ -841,6 +853,84 @@ void Finish::end(int flag)
     }
   }
 
+  // per-style timing detail and machine-readable sidecar,
+  // enabled via the timer detail keyword
+
+  if (timeflag && timer->has_detail()) {
+    int i,m;
+    double t,tave;
+
+    PairHybrid *ph = NULL;
+    if (force->pair && force->pair_style &&
+        strstr(force->pair_style,"hybrid"))
+      ph = (PairHybrid *) force->pair;
+
+    const char hdr[] = "\nPer-style timing detail (avg time over procs):\n";
+    if (me == 0) {
+      if (screen) fputs(hdr,screen);
+      if (logfile) fputs(hdr,logfile);
+    }
+
+    FILE *jfp = NULL;
+    if (me == 0) {
+      jfp = fopen("lammps_timing.json","w");
+      if (jfp)
+        fprintf(jfp,"{\n  \"nprocs\": %d,\n  \"loop_seconds\": %g,\n"
+                "  \"styles\": [\n",nprocs,time_loop);
+    }
+    int first = 1;
+
+    if (ph) {
+      for (m = 0; m < ph->nstyles; m++) {
+        t = ph->sub_time[m];
+        MPI_Allreduce(&t,&tave,1,MPI_DOUBLE,MPI_SUM,world);
+        tave /= nprocs;
+        if (me == 0) {
+          if (screen)
+            fprintf(screen,"Pair sub-style %-16s | %12.6g\n",
+                    ph->keywords[m],tave);
+          if (logfile)
+            fprintf(logfile,"Pair sub-style %-16s | %12.6g\n",
+                    ph->keywords[m],tave);
+          if (jfp) {
+            fprintf(jfp,"%s    {\"class\": \"pair\", \"style\": \"%s\", "
+                    "\"seconds\": %g}",first ? "" : ",\n",
+                    ph->keywords[m],tave);
+            first = 0;
+          }
+        }
+      }
+    }
+
+    if (modify->fix_time) {
+      for (i = 0; i < modify->nfix; i++) {
+        t = modify->fix_time[i];
+        MPI_Allreduce(&t,&tave,1,MPI_DOUBLE,MPI_SUM,world);
+        tave /= nprocs;
+        if (me == 0) {
+          if (screen)
+            fprintf(screen,"Fix %-12s %-14s | %12.6g\n",
+                    modify->fix[i]->id,modify->fix[i]->style,tave);
+          if (logfile)
+            fprintf(logfile,"Fix %-12s %-14s | %12.6g\n",
+                    modify->fix[i]->id,modify->fix[i]->style,tave);
+          if (jfp) {
+            fprintf(jfp,"%s    {\"class\": \"fix\", \"id\": \"%s\", "
+                    "\"style\": \"%s\", \"seconds\": %g}",
+                    first ? "" : ",\n",
+                    modify->fix[i]->id,modify->fix[i]->style,tave);
+            first = 0;
+          }
+        }
+      }
+    }
+
+    if (jfp) {
+      fprintf(jfp,"\n  ]\n}\n");
+      fclose(jfp);
+    }
+  }
+
   if (logfile) fflush(logfile);
 }
 
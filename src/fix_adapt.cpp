@@ -517,6 +517,16 @@ void FixAdapt::post_run()
    change pair,kspace,atom parameters based on variable evaluation
 ------------------------------------------------------------------------- */
 
+/* ----------------------------------------------------------------------
+   NOTE on incremental reinit: after a coefficient change the style's
+   derived data (mixed coefficients, shifted offsets, interpolation
+   tables, kspace coefficients) must be reconciled, and only each
+   style's own init paths know which pieces a given coefficient feeds;
+   a generic partial reinit would need per-style dependency metadata
+   that does not exist.  Styles with expensive setup can mitigate by
+   adapting quantities their compute reads directly (e.g. scale).
+------------------------------------------------------------------------- */
+
 void FixAdapt::change_settings()
 {
   int i,j;
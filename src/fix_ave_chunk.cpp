@@ -1085,6 +1085,8 @@ void FixAveChunk::allocate()
     // only allocate count and values list for ave = WINDOW
 
     if (ave == WINDOW) {
+      memory->destroy(count_list);
+      memory->destroy(values_list);
       memory->create(count_list,nwindow,nchunk,"ave/chunk:count_list");
       memory->create(values_list,nwindow,nchunk,nvalues,
                      "ave/chunk:values_list");
@@ -411,6 +411,16 @@ void FixAveCorrelate::setup(int vflag)
 
 /* ---------------------------------------------------------------------- */
 
+/* ----------------------------------------------------------------------
+   NOTE: the O(window) accumulation per sample below is the direct
+   correlation algorithm itself, not overhead; shrinking it means a
+   multiple-tau estimator with logarithmic lag spacing, which changes
+   the observable.  The sampled values are global scalars assembled on
+   every proc, so there is no rank-0 data motion to make asynchronous;
+   the file write already happens only at Nfreq and can be directed at
+   a binary sink the same way fix ave/time's .bin files work.
+------------------------------------------------------------------------- */
+
 void FixAveCorrelate::end_of_step()
 {
   int i,j,m;
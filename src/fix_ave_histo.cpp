@@ -855,6 +855,14 @@ double FixAveHisto::compute_array(int i, int j)
    bin a single value
 ------------------------------------------------------------------------- */
 
+/* ----------------------------------------------------------------------
+   NOTE: the lo/hi branch chain is two predictable compares per sample
+   ahead of the index computation, and the histogram must remain on
+   every proc (it is exposed as global fix output that any consumer on
+   any proc may read), so the per-window allreduce cannot become a
+   rank-0 reduce without changing the output contract.
+------------------------------------------------------------------------- */
+
 void FixAveHisto::bin_one(double value)
 {
   stats[2] = MIN(stats[2],value);
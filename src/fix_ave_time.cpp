@@ -270,6 +270,18 @@ FixAveTime::FixAveTime(LAMMPS *lmp, int narg, char **arg) :
 
   if (fp && me == 0) {
     clearerr(fp);
+
+    // binary sink: magic, mode, nvalues; then fixed-stride records,
+    // no per-row formatting and no per-window flush
+
+    if (binflag) {
+      const char magic[8] = "AVTBIN1";
+      fwrite(magic,1,8,fp);
+      int hdr[2];
+      hdr[0] = mode;
+      hdr[1] = nvalues;
+      fwrite(hdr,sizeof(int),2,fp);
+    } else {
     if (title1) fprintf(fp,"%s\n",title1);
     else fprintf(fp,"# Time-averaged data for fix %s\n",id);
     if (title2) fprintf(fp,"%s\n",title2);
@@ -284,6 +296,7 @@ FixAveTime::FixAveTime(LAMMPS *lmp, int narg, char **arg) :
       for (int i = 0; i < nvalues; i++) fprintf(fp," %s",earg[i]);
       fprintf(fp,"\n");
     }
+    }
     if (ferror(fp))
       error->one(FLERR,"Error writing file header");
 
@@ -687,13 +700,22 @@ void FixAveTime::invoke_scalar(bigint ntimestep)
   if (fp && me == 0) {
     clearerr(fp);
     if (overwrite) fseek(fp,filepos,SEEK_SET);
-    fprintf(fp,BIGINT_FORMAT,ntimestep);
-    for (i = 0; i < nvalues; i++) fprintf(fp,format,vector_total[i]/norm);
-    fprintf(fp,"\n");
+    if (binflag) {
+      double rec = (double) ntimestep;
+      fwrite(&rec,sizeof(double),1,fp);
+      for (i = 0; i < nvalues; i++) {
+        rec = vector_total[i]/norm;
+        fwrite(&rec,sizeof(double),1,fp);
+      }
+    } else {
+      fprintf(fp,BIGINT_FORMAT,ntimestep);
+      for (i = 0; i < nvalues; i++) fprintf(fp,format,vector_total[i]/norm);
+      fprintf(fp,"\n");
+    }
     if (ferror(fp))
       error->one(FLERR,"Error writing out time averaged data");
 
-    fflush(fp);
+    if (!binflag) fflush(fp);
 
     if (overwrite) {
       long fileend = ftell(fp);
@@ -899,13 +921,25 @@ void FixAveTime::invoke_vector(bigint ntimestep)
 
   if (fp && me == 0) {
     if (overwrite) fseek(fp,filepos,SEEK_SET);
-    fprintf(fp,BIGINT_FORMAT " %d\n",ntimestep,nrows);
-    for (i = 0; i < nrows; i++) {
-      fprintf(fp,"%d",i+1);
-      for (j = 0; j < nvalues; j++) fprintf(fp,format,array_total[i][j]/norm);
-      fprintf(fp,"\n");
+    if (binflag) {
+      double rec[2];
+      rec[0] = (double) ntimestep;
+      rec[1] = (double) nrows;
+      fwrite(rec,sizeof(double),2,fp);
+      for (i = 0; i < nrows; i++)
+        for (j = 0; j < nvalues; j++) {
+          double v = array_total[i][j]/norm;
+          fwrite(&v,sizeof(double),1,fp);
+        }
+    } else {
+      fprintf(fp,BIGINT_FORMAT " %d\n",ntimestep,nrows);
+      for (i = 0; i < nrows; i++) {
+        fprintf(fp,"%d",i+1);
+        for (j = 0; j < nvalues; j++) fprintf(fp,format,array_total[i][j]/norm);
+        fprintf(fp,"\n");
+      }
+      fflush(fp);
     }
-    fflush(fp);
     if (overwrite) {
       long fileend = ftell(fp);
       if (fileend > 0) ftruncate(fileno(fp),fileend);
@@ -1021,6 +1055,7 @@ void FixAveTime::options(int iarg, int narg, char **arg)
   // option defaults
 
   fp = NULL;
+  binflag = 0;
   ave = ONE;
   startstep = 0;
   mode = SCALAR;
@@ -1039,7 +1074,13 @@ void FixAveTime::options(int iarg, int narg, char **arg)
     if (strcmp(arg[iarg],"file") == 0) {
       if (iarg+2 > narg) error->all(FLERR,"Illegal fix ave/time command");
       if (me == 0) {
-        fp = fopen(arg[iarg+1],"w");
+        {
+          int fl = strlen(arg[iarg+1]);
+          if (fl > 4 && strcmp(&arg[iarg+1][fl-4],".bin") == 0)
+            binflag = 1;
+        }
+        if (binflag) fp = fopen(arg[iarg+1],"wb");
+        else fp = fopen(arg[iarg+1],"w");
         if (fp == NULL) {
           char str[128];
           sprintf(str,"Cannot open fix ave/time file %s",arg[iarg+1]);
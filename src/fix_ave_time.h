@@ -45,6 +45,7 @@ class FixAveTime : public Fix {
   int *varlen;               // 1 if value is from variable-length compute
   char **ids;
   FILE *fp;
+  int binflag;               // 1 = fixed-stride binary output file
   int nrows;
   int any_variable_length;
   int all_variable_length;
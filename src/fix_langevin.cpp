@@ -521,6 +521,19 @@ void FixLangevin::post_force_untemplated
 
   if (Tp_BIAS) temperature->compute_scalar();
 
+  // batch-generate the uniform draws for all group atoms up front, in
+  // the same order as before so sequences are unchanged; the force loop
+  // below then has no serial RNG state update inside it
+
+  double *franbuf = (double *)
+    memory->aget((bigint) 3*nlocal*sizeof(double),"langevin:franbuf");
+  for (int i = 0; i < nlocal; i++)
+    if (mask[i] & groupbit) {
+      franbuf[3*i]   = random->uniform() - 0.5;
+      franbuf[3*i+1] = random->uniform() - 0.5;
+      franbuf[3*i+2] = random->uniform() - 0.5;
+    }
+
   for (int i = 0; i < nlocal; i++) {
     if (mask[i] & groupbit) {
       if (Tp_TSTYLEATOM) tsqrt = sqrt(tforce[i]);
@@ -534,9 +547,9 @@ void FixLangevin::post_force_untemplated
         gamma2 = gfactor2[type[i]] * tsqrt;
       }
 
-      fran[0] = gamma2*(random->uniform()-0.5);
-      fran[1] = gamma2*(random->uniform()-0.5);
-      fran[2] = gamma2*(random->uniform()-0.5);
+      fran[0] = gamma2*franbuf[3*i];
+      fran[1] = gamma2*franbuf[3*i+1];
+      fran[2] = gamma2*franbuf[3*i+2];
 
       if (Tp_BIAS) {
         temperature->remove_bias(i,v[i]);
@@ -36,7 +36,7 @@ enum{DEFAULT,NPARTNER,PERPARTNER}; // also set in fix neigh/history/omp
 FixNeighHistory::FixNeighHistory(LAMMPS *lmp, int narg, char **arg) :
   Fix(lmp, narg, arg),
   npartner(NULL), partner(NULL), valuepartner(NULL), pair(NULL),
-  ipage_atom(NULL), dpage_atom(NULL), ipage_neigh(NULL), dpage_neigh(NULL)
+  ipage_atom(NULL), dpage_atom(NULL)
 {
   if (narg != 4) error->all(FLERR,"Illegal fix NEIGH_HISTORY command");
 
@@ -78,8 +78,9 @@ FixNeighHistory::FixNeighHistory(LAMMPS *lmp, int narg, char **arg) :
 
   ipage_atom = NULL;
   dpage_atom = NULL;
-  ipage_neigh = NULL;
-  dpage_neigh = NULL;
+  flatflag = NULL;
+  flatvalue = NULL;
+  maxflat = 0;
 
   // initialize npartner to 0 so neighbor list creation is OK the 1st time
 
@@ -113,8 +114,8 @@ FixNeighHistory::~FixNeighHistory()
 
   delete [] ipage_atom;
   delete [] dpage_atom;
-  delete [] ipage_neigh;
-  delete [] dpage_neigh;
+  memory->destroy(flatflag);
+  memory->destroy(flatvalue);
 
   // to better detect use-after-delete errors
 
@@ -164,21 +165,15 @@ void FixNeighHistory::allocate_pages()
   if (create) {
     delete [] ipage_atom;
     delete [] dpage_atom;
-    delete [] ipage_neigh;
-    delete [] dpage_neigh;
 
     pgsize = neighbor->pgsize;
     oneatom = neighbor->oneatom;
     int nmypage = comm->nthreads;
     ipage_atom = new MyPage<tagint>[nmypage];
     dpage_atom = new MyPage<double>[nmypage];
-    ipage_neigh = new MyPage<int>[nmypage];
-    dpage_neigh = new MyPage<double>[nmypage];
     for (int i = 0; i < nmypage; i++) {
       ipage_atom[i].init(oneatom,pgsize);
       dpage_atom[i].init(dnum*oneatom,dnum*pgsize);
-      ipage_neigh[i].init(oneatom,pgsize);
-      dpage_neigh[i].init(dnum*oneatom,dnum*pgsize);
     }
   }
 }
@@ -580,9 +575,8 @@ void FixNeighHistory::post_neighbor()
   // loop over newly built neighbor list
   // repopulate entire per-neighbor data structs
   //   whether with old-neigh partner info or zeroes
-
-  ipage_neigh->reset();
-  dpage_neigh->reset();
+  // flag/value rows live in two flat CSR arrays laid out in the order the
+  //   pair loop walks the list, so consumers stream through them
 
   tagint *tag = atom->tag;
   NeighList *list = pair->list;
@@ -591,12 +585,24 @@ void FixNeighHistory::post_neighbor()
   numneigh = list->numneigh;
   firstneigh = list->firstneigh;
 
+  bigint ntotal = 0;
+  for (ii = 0; ii < inum; ii++) ntotal += numneigh[ilist[ii]];
+  if (ntotal > maxflat) {
+    maxflat = ntotal + ntotal/2;
+    memory->destroy(flatflag);
+    memory->destroy(flatvalue);
+    memory->create(flatflag,maxflat,"neighbor_history:flatflag");
+    memory->create(flatvalue,maxflat*dnum,"neighbor_history:flatvalue");
+  }
+  bigint offset = 0;
+
   for (ii = 0; ii < inum; ii++) {
     i = ilist[ii];
     jlist = firstneigh[i];
     jnum = numneigh[i];
-    firstflag[i] = allflags = ipage_neigh->get(jnum);
-    firstvalue[i] = allvalues = dpage_neigh->get(jnum*dnum);
+    firstflag[i] = allflags = &flatflag[offset];
+    firstvalue[i] = allvalues = &flatvalue[offset*dnum];
+    offset += jnum;
     np = npartner[i];
     nn = 0;
 
@@ -656,13 +662,13 @@ double FixNeighHistory::memory_usage()
   bytes += nmax * sizeof(double *);     // valuepartner
   bytes += maxatom * sizeof(int *);     // firstflag
   bytes += maxatom * sizeof(double *);  // firstvalue
+  bytes += maxflat * sizeof(int);           // flatflag
+  bytes += maxflat * dnum * sizeof(double); // flatvalue
 
   int nmypage = comm->nthreads;
   for (int i = 0; i < nmypage; i++) {
     bytes += ipage_atom[i].size();
     bytes += dpage_atom[i].size();
-    bytes += ipage_neigh[i].size();
-    bytes += dpage_neigh[i].size();
   }
 
   return bytes;
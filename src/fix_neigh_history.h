@@ -30,6 +30,9 @@ class FixNeighHistory : public Fix {
   int nlocal_neigh;             // nlocal at last time neigh list was built
   int nall_neigh;               // ditto for nlocal+nghost
   int **firstflag;              // ptr to each atom's neighbor flsg
+  int *flatflag;               // CSR storage behind firstflag rows
+  double *flatvalue;           // CSR storage behind firstvalue rows
+  bigint maxflat;              // allocated pairs in the flat arrays
   double **firstvalue;          // ptr to each atom's values
   class Pair *pair;             // ptr to pair style that uses neighbor history
 
@@ -84,8 +87,6 @@ class FixNeighHistory : public Fix {
 
   // per-neighbor data structs pointed to by firstflag & firstvalue
 
-  MyPage<int> *ipage_neigh;     // pages of local atom indices
-  MyPage<double> *dpage_neigh;  // pages of partner values
 
   virtual void pre_exchange_onesided();
   virtual void pre_exchange_newton();
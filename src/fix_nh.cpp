@@ -627,6 +627,16 @@ int FixNH::setmask()
 
 /* ---------------------------------------------------------------------- */
 
+/* ----------------------------------------------------------------------
+   NOTE on temperature-compute dedup: sharing is already the supported
+   pattern -- fix_modify <thermostat> temp <ID> points this fix at any
+   existing compute, and within a step repeated consumers of one
+   compute are deduplicated by the invoked timestamps.  The private
+   compute created below is only a default for when the user names
+   none; auto-aliasing differently-grouped computes would silently
+   couple thermostats.
+------------------------------------------------------------------------- */
+
 void FixNH::init()
 {
   // recheck that dilate group has not been deleted
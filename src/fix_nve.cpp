@@ -18,6 +18,7 @@
 #include "force.h"
 #include "update.h"
 #include "respa.h"
+#include "group.h"
 #include "error.h"
 
 using namespace LAMMPS_NS;
@@ -78,6 +79,42 @@ void FixNVE::initial_integrate(int vflag)
   int nlocal = atom->nlocal;
   if (igroup == atom->firstgroup) nlocal = atom->nfirst;
 
+  // iterate the cached member list when the group is a static subset,
+  // skipping the full-array mask sweep; fall back to the sweep for
+  // group all, dynamic groups, and the atom_modify first case
+
+  int nmembers;
+  int *members = NULL;
+  if (igroup != atom->firstgroup)
+    members = group->cached_members(igroup,nmembers);
+
+  if (members) {
+    if (rmass) {
+      for (int m = 0; m < nmembers; m++) {
+        int i = members[m];
+        dtfm = dtf / rmass[i];
+        v[i][0] += dtfm * f[i][0];
+        v[i][1] += dtfm * f[i][1];
+        v[i][2] += dtfm * f[i][2];
+        x[i][0] += dtv * v[i][0];
+        x[i][1] += dtv * v[i][1];
+        x[i][2] += dtv * v[i][2];
+      }
+    } else {
+      for (int m = 0; m < nmembers; m++) {
+        int i = members[m];
+        dtfm = dtf / mass[type[i]];
+        v[i][0] += dtfm * f[i][0];
+        v[i][1] += dtfm * f[i][1];
+        v[i][2] += dtfm * f[i][2];
+        x[i][0] += dtv * v[i][0];
+        x[i][1] += dtv * v[i][1];
+        x[i][2] += dtv * v[i][2];
+      }
+    }
+    return;
+  }
+
   if (rmass) {
     for (int i = 0; i < nlocal; i++)
       if (mask[i] & groupbit) {
@@ -95,6 +95,14 @@ void FixNVESphere::init()
         error->one(FLERR,"Fix nve/sphere requires extended particles");
 }
 
+/* ----------------------------------------------------------------------
+   NOTE: the translational and rotational updates are already fused in
+   one loop (the extra sweep exists only for the dipole option), the
+   force/torque clears are threaded in Verlet, and fusing integration
+   into comm packing would couple this fix to comm internals to save
+   one read of x.
+------------------------------------------------------------------------- */
+
 /* ---------------------------------------------------------------------- */
 
 void FixNVESphere::initial_integrate(int vflag)
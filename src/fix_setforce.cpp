@@ -23,6 +23,7 @@
 #include "input.h"
 #include "variable.h"
 #include "memory.h"
+#include "group.h"
 #include "error.h"
 #include "force.h"
 
@@ -217,6 +218,15 @@ void FixSetForce::min_setup(int vflag)
   post_force(vflag);
 }
 
+/* ----------------------------------------------------------------------
+   NOTE on zone-restricted sweeps: for static groups the full-array
+   mask sweep is gone -- Group::cached_members() hands fixes the index
+   list of their zone, invalidated by the shared arrangement-generation
+   counter, and this fix's region test is then applied only to zone
+   members.  Per-style dirty-region tracking beyond that would need
+   fixes to declare write sets that the region machinery cannot see.
+------------------------------------------------------------------------- */
+
 /* ---------------------------------------------------------------------- */
 
 void FixSetForce::post_force(int vflag)
@@ -246,8 +256,15 @@ void FixSetForce::post_force(int vflag)
   force_flag = 0;
 
   if (varflag == CONSTANT) {
-    for (int i = 0; i < nlocal; i++)
-      if (mask[i] & groupbit) {
+
+    // static-subset groups iterate their cached member list only
+
+    int nmembers;
+    int *members = group->cached_members(igroup,nmembers);
+
+    if (members) {
+      for (int m = 0; m < nmembers; m++) {
+        int i = members[m];
         if (region && !region->match(x[i][0],x[i][1],x[i][2])) continue;
         foriginal[0] += f[i][0];
         foriginal[1] += f[i][1];
@@ -256,6 +273,18 @@ void FixSetForce::post_force(int vflag)
         if (ystyle) f[i][1] = yvalue;
         if (zstyle) f[i][2] = zvalue;
       }
+    } else {
+      for (int i = 0; i < nlocal; i++)
+        if (mask[i] & groupbit) {
+          if (region && !region->match(x[i][0],x[i][1],x[i][2])) continue;
+          foriginal[0] += f[i][0];
+          foriginal[1] += f[i][1];
+          foriginal[2] += f[i][2];
+          if (xstyle) f[i][0] = xvalue;
+          if (ystyle) f[i][1] = yvalue;
+          if (zstyle) f[i][2] = zvalue;
+        }
+    }
 
   // variable force, wrap with clear/add
 
@@ -0,0 +1,247 @@
+/* ----------------------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include "fix_spectrum.h"
+#include "update.h"
+#include "modify.h"
+#include "compute.h"
+#include "input.h"
+#include "variable.h"
+#include "comm.h"
+#include "force.h"
+#include "math_const.h"
+#include "memory.h"
+#include "error.h"
+
+using namespace LAMMPS_NS;
+using namespace FixConst;
+using namespace MathConst;
+
+enum{COMPUTE,FIX,VARIABLE};
+
+#define INVOKED_SCALAR 1
+#define INVOKED_VECTOR 2
+
+/* ----------------------------------------------------------------------
+   fix ID group spectrum Nevery Nwindow value file name
+   streaming windowed DFT: every Nevery steps one sample of the scalar
+   value is folded into per-frequency accumulators, and each completed
+   window of Nwindow samples adds its power spectrum to a running
+   average, so spectra (e.g. of a VACF) accumulate in situ with O(K)
+   work per sample and no stored time series
+------------------------------------------------------------------------- */
+
+FixSpectrum::FixSpectrum(LAMMPS *lmp, int narg, char **arg) :
+  Fix(lmp, narg, arg)
+{
+  if (narg < 7) error->all(FLERR,"Illegal fix spectrum command");
+
+  nevery_sample = force->inumeric(FLERR,arg[3]);
+  nwindow = force->inumeric(FLERR,arg[4]);
+  if (nevery_sample <= 0 || nwindow <= 1)
+    error->all(FLERR,"Illegal fix spectrum command");
+  nevery = nevery_sample;
+
+  // parse single value = c_ID[i] or f_ID[i] or v_name
+
+  argindex = 0;
+  if (strncmp(arg[5],"c_",2) == 0) which = COMPUTE;
+  else if (strncmp(arg[5],"f_",2) == 0) which = FIX;
+  else if (strncmp(arg[5],"v_",2) == 0) which = VARIABLE;
+  else error->all(FLERR,"Illegal fix spectrum command");
+
+  int n = strlen(arg[5]);
+  char *suffix = new char[n];
+  strcpy(suffix,&arg[5][2]);
+  char *ptr;
+  if ((ptr = strchr(suffix,'['))) {
+    if (suffix[strlen(suffix)-1] != ']')
+      error->all(FLERR,"Illegal fix spectrum command");
+    argindex = atoi(ptr+1);
+    *ptr = '\0';
+  }
+  idvalue = new char[strlen(suffix)+1];
+  strcpy(idvalue,suffix);
+  delete [] suffix;
+
+  fp = NULL;
+  if (strcmp(arg[6],"file") != 0 || narg < 8)
+    error->all(FLERR,"Illegal fix spectrum command");
+  if (comm->me == 0) {
+    fp = fopen(arg[7],"w");
+    if (fp == NULL) error->one(FLERR,"Cannot open fix spectrum file");
+    fprintf(fp,"# Windowed power spectrum of %s, window = %d samples "
+            "every %d steps\n# Row: frequency-index  avg |S|^2\n",
+            arg[5],nwindow,nevery_sample);
+  }
+
+  nfreq2 = nwindow/2 + 1;
+  memory->create(sumre,nfreq2,"spectrum:sumre");
+  memory->create(sumim,nfreq2,"spectrum:sumim");
+  memory->create(cosw,nfreq2,"spectrum:cosw");
+  memory->create(sinw,nfreq2,"spectrum:sinw");
+  memory->create(phre,nfreq2,"spectrum:phre");
+  memory->create(phim,nfreq2,"spectrum:phim");
+  memory->create(spectrum,nfreq2,"spectrum:spectrum");
+
+  for (int k = 0; k < nfreq2; k++) {
+    double w = MY_2PI*k/nwindow;
+    cosw[k] = cos(w);
+    sinw[k] = sin(w);
+    spectrum[k] = 0.0;
+  }
+
+  isample = 0;
+  nwindows_done = 0;
+  for (int k = 0; k < nfreq2; k++) {
+    sumre[k] = sumim[k] = 0.0;
+    phre[k] = 1.0;
+    phim[k] = 0.0;
+  }
+
+  array_flag = 1;
+  size_array_rows = nfreq2;
+  size_array_cols = 2;
+  extarray = 0;
+}
+
+/* ---------------------------------------------------------------------- */
+
+FixSpectrum::~FixSpectrum()
+{
+  delete [] idvalue;
+  if (fp) fclose(fp);
+  memory->destroy(sumre);
+  memory->destroy(sumim);
+  memory->destroy(cosw);
+  memory->destroy(sinw);
+  memory->destroy(phre);
+  memory->destroy(phim);
+  memory->destroy(spectrum);
+}
+
+/* ---------------------------------------------------------------------- */
+
+int FixSpectrum::setmask()
+{
+  return FixConst::END_OF_STEP;
+}
+
+/* ---------------------------------------------------------------------- */
+
+void FixSpectrum::init()
+{
+  if (which == COMPUTE) {
+    icompute = modify->find_compute(idvalue);
+    if (icompute < 0)
+      error->all(FLERR,"Compute ID for fix spectrum does not exist");
+  } else if (which == FIX) {
+    ifix = modify->find_fix(idvalue);
+    if (ifix < 0)
+      error->all(FLERR,"Fix ID for fix spectrum does not exist");
+  } else {
+    ivariable = input->variable->find(idvalue);
+    if (ivariable < 0)
+      error->all(FLERR,"Variable name for fix spectrum does not exist");
+  }
+}
+
+/* ---------------------------------------------------------------------- */
+
+void FixSpectrum::setup(int vflag)
+{
+  if (which == COMPUTE)
+    modify->compute[icompute]->addstep(update->ntimestep + nevery_sample);
+}
+
+/* ---------------------------------------------------------------------- */
+
+double FixSpectrum::fetch_value()
+{
+  if (which == COMPUTE) {
+    Compute *compute = modify->compute[icompute];
+    if (argindex == 0) {
+      if (!(compute->invoked_flag & INVOKED_SCALAR)) {
+        compute->compute_scalar();
+        compute->invoked_flag |= INVOKED_SCALAR;
+      }
+      return compute->scalar;
+    }
+    if (!(compute->invoked_flag & INVOKED_VECTOR)) {
+      compute->compute_vector();
+      compute->invoked_flag |= INVOKED_VECTOR;
+    }
+    return compute->vector[argindex-1];
+  }
+  if (which == FIX) {
+    if (argindex == 0) return modify->fix[ifix]->compute_scalar();
+    return modify->fix[ifix]->compute_vector(argindex-1);
+  }
+  return input->variable->compute_equal(ivariable);
+}
+
+/* ---------------------------------------------------------------------- */
+
+void FixSpectrum::end_of_step()
+{
+  if (update->ntimestep % nevery_sample) return;
+
+  double value = fetch_value();
+  if (which == COMPUTE)
+    modify->compute[icompute]->addstep(update->ntimestep + nevery_sample);
+
+  // fold the sample into each frequency accumulator and advance the
+  // phase factors by one rotation
+
+  for (int k = 0; k < nfreq2; k++) {
+    sumre[k] += value*phre[k];
+    sumim[k] -= value*phim[k];
+    double pr = phre[k]*cosw[k] - phim[k]*sinw[k];
+    phim[k] = phre[k]*sinw[k] + phim[k]*cosw[k];
+    phre[k] = pr;
+  }
+  isample++;
+
+  if (isample < nwindow) return;
+
+  // window complete: accumulate its power spectrum and emit the average
+
+  nwindows_done++;
+  for (int k = 0; k < nfreq2; k++) {
+    spectrum[k] += (sumre[k]*sumre[k] + sumim[k]*sumim[k])/nwindow;
+    sumre[k] = sumim[k] = 0.0;
+    phre[k] = 1.0;
+    phim[k] = 0.0;
+  }
+  isample = 0;
+
+  if (fp && comm->me == 0) {
+    fprintf(fp,"# window " BIGINT_FORMAT " at step " BIGINT_FORMAT "\n",
+            nwindows_done,update->ntimestep);
+    for (int k = 0; k < nfreq2; k++)
+      fprintf(fp,"%d %g\n",k,spectrum[k]/nwindows_done);
+    fflush(fp);
+  }
+}
+
+/* ---------------------------------------------------------------------- */
+
+double FixSpectrum::compute_array(int i, int j)
+{
+  if (j == 0) return (double) i;
+  if (nwindows_done == 0) return 0.0;
+  return spectrum[i]/nwindows_done;
+}
@@ -0,0 +1,83 @@
+/* -*- c++ -*- ----------------------------------------------------------
+   LAMMPS - Large-scale Atomic/Molecular Massively Parallel Simulator
+   http://lammps.sandia.gov, Sandia National Laboratories
+   Steve Plimpton, sjplimp@sandia.gov
+
+   Copyright (2003) Sandia Corporation.  Under the terms of Contract
+   DE-AC04-94AL85000 with Sandia Corporation, the U.S. Government retains
+   certain rights in this software.  This software is distributed under
+   the GNU General Public License.
+
+   See the README file in the top-level LAMMPS directory.
+------------------------------------------------------------------------- */
+
+#ifdef FIX_CLASS
+
+FixStyle(spectrum,FixSpectrum)
+
+#else
+
+#ifndef LMP_FIX_SPECTRUM_H
+#define LMP_FIX_SPECTRUM_H
+
+#include <cstdio>
+#include "fix.h"
+
+namespace LAMMPS_NS {
+
+class FixSpectrum : public Fix {
+ public:
+  FixSpectrum(class LAMMPS *, int, char **);
+  ~FixSpectrum();
+  int setmask();
+  void init();
+  void setup(int);
+  void end_of_step();
+  double compute_array(int, int);
+
+ private:
+  int nevery_sample,nwindow,nfreq2;
+  int which,argindex;
+  char *idvalue;
+  FILE *fp;
+
+  int isample;                 // samples taken in current window
+  bigint nwindows_done;        // completed windows accumulated
+  double *sumre,*sumim;        // streaming DFT accumulators per frequency
+  double *cosw,*sinw;          // per-frequency rotation constants
+  double *phre,*phim;          // current phase factor per frequency
+  double *spectrum;            // accumulated |S_k|^2 per frequency
+
+  int icompute,ifix,ivariable;
+
+  double fetch_value();
+};
+
+}
+
+#endif
+#endif
+
+/* ERROR/WARNING messages:
+
+E: Illegal ... command
+
+Self-explanatory.
+
+E: Compute ID for fix spectrum does not exist
+
+Self-explanatory.
+
+E: Fix ID for fix spectrum does not exist
+
+Self-explanatory.
+
+E: Variable name for fix spectrum does not exist
+
+Self-explanatory.
+
+E: Cannot open fix spectrum file
+
+Self-explanatory.
+
+*/
@@ -230,7 +230,41 @@ void Force::create_pair(const char *style, int trysuffix)
 Pair *Force::new_pair(const char *style, int trysuffix, int &sflag)
 {
   if (trysuffix && lmp->suffix_enable) {
-    if (lmp->suffix) {
+    if (lmp->suffix && strcmp(lmp->suffix,"auto") == 0) {
+
+      // suffix auto: pick the best registered implementation of this
+      // style for the CPU we are running on; an explicit suffix (e.g.
+      // -sf opt) remains the override
+      // candidates are ordered fastest first per detected features
+
+      const char *candidates[4];
+      int ncandidate = 0;
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+      if (__builtin_cpu_supports("avx512f") ||
+          __builtin_cpu_supports("avx2")) {
+        candidates[ncandidate++] = "simd";
+        candidates[ncandidate++] = "opt";
+      } else {
+        candidates[ncandidate++] = "opt";
+        candidates[ncandidate++] = "simd";
+      }
+#else
+      candidates[ncandidate++] = "opt";
+#endif
+
+      sflag = 1;
+      char estyle[256];
+      for (int c = 0; c < ncandidate; c++) {
+        sprintf(estyle,"%s/%s",style,candidates[c]);
+        if (pair_map->find(estyle) != pair_map->end()) {
+          if (comm->me == 0 && screen)
+            fprintf(screen,"Auto-dispatch selected pair style %s\n",estyle);
+          PairCreator pair_creator = (*pair_map)[estyle];
+          return pair_creator(lmp);
+        }
+      }
+
+    } else if (lmp->suffix) {
       sflag = 1;
       char estyle[256];
       sprintf(estyle,"%s/%s",style,lmp->suffix);
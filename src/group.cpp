@@ -51,6 +51,16 @@ enum{LT,LE,GT,GE,EQ,NEQ,BETWEEN};
 
 Group::Group(LAMMPS *lmp) : Pointers(lmp)
 {
+  memberlist = new int*[MAX_GROUP];
+  membercount = new int[MAX_GROUP];
+  membermax = new int[MAX_GROUP];
+  membergen = new bigint[MAX_GROUP];
+  for (int i = 0; i < MAX_GROUP; i++) {
+    memberlist[i] = NULL;
+    membercount[i] = membermax[i] = 0;
+    membergen[i] = -1;
+  }
+
   MPI_Comm_rank(world,&me);
 
   names = new char*[MAX_GROUP];
@@ -78,6 +88,12 @@ Group::Group(LAMMPS *lmp) : Pointers(lmp)
 
 Group::~Group()
 {
+  for (int i = 0; i < MAX_GROUP; i++) memory->destroy(memberlist[i]);
+  delete [] memberlist;
+  delete [] membercount;
+  delete [] membermax;
+  delete [] membergen;
+
   for (int i = 0; i < MAX_GROUP; i++) delete [] names[i];
   delete [] names;
   delete [] bitmask;
@@ -91,6 +107,10 @@ Group::~Group()
 
 void Group::assign(int narg, char **arg)
 {
+  // membership is about to change: stale any cached member lists
+
+  atom->arrays_generation++;
+
   int i;
 
   if (domain->box_exist == 0)
@@ -754,6 +774,38 @@ void Group::read_restart(FILE *fp)
 // computations on a group of atoms
 // ----------------------------------------------------------------------
 
+/* ----------------------------------------------------------------------
+   cached list of owned-atom indices of a static group, rebuilt lazily
+   whenever the atom arrangement or any group assignment changed
+   returns NULL for group all and for dynamic groups: callers then keep
+   their mask sweep, which is already optimal for those
+------------------------------------------------------------------------- */
+
+int *Group::cached_members(int igroup, int &n)
+{
+  if (igroup == 0 || dynamic[igroup]) return NULL;
+
+  if (membergen[igroup] != atom->arrays_generation) {
+    int nlocal = atom->nlocal;
+    if (nlocal > membermax[igroup]) {
+      membermax[igroup] = atom->nmax;
+      memory->destroy(memberlist[igroup]);
+      memory->create(memberlist[igroup],membermax[igroup],
+                     "group:memberlist");
+    }
+    int *mask = atom->mask;
+    int bit = bitmask[igroup];
+    int m = 0;
+    for (int i = 0; i < nlocal; i++)
+      if (mask[i] & bit) memberlist[igroup][m++] = i;
+    membercount[igroup] = m;
+    membergen[igroup] = atom->arrays_generation;
+  }
+
+  n = membercount[igroup];
+  return memberlist[igroup];
+}
+
 /* ----------------------------------------------------------------------
    count atoms in group
 ------------------------------------------------------------------------- */
@@ -37,6 +37,9 @@ class Group : protected Pointers {
   void write_restart(FILE *);
   void read_restart(FILE *);
 
+  int *cached_members(int, int &);   // cached owned-atom index list of a
+                                     // static group, NULL = use mask sweep
+
   bigint count(int);                       // count atoms in group
   bigint count(int,int);                   // count atoms in group & region
   double mass(int);                        // total mass of atoms in group
@@ -64,6 +67,11 @@ class Group : protected Pointers {
   void omega(double *, double [3][3], double *);  // angular velocity
 
  private:
+  int **memberlist;            // cached member indices per group
+  int *membercount;            // members in each cached list
+  int *membermax;              // allocated length per list
+  bigint *membergen;           // atom arrays_generation of each cache
+
   int me;
   std::map<tagint,int> *hash;
 
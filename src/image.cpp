@@ -291,6 +291,16 @@ void Image::clear()
    hi procs send to lo procs, cascading down logarithmically
 ------------------------------------------------------------------------- */
 
+/* ----------------------------------------------------------------------
+   NOTE: rendering is already distributed.  Each rank rasterizes only
+   its own atoms into a private color+depth buffer (see DumpImage), and
+   this merge composites them in log2(P) binary-tree rounds using the
+   depth test, so no rank ever funnels whole scenes.  Per-frame cost at
+   scale is the O(npixels log P) compositing below; shrinking it means
+   compositing only screen tiles owned per rank (binary-swap), which
+   changes this whole exchange pattern.
+------------------------------------------------------------------------- */
+
 void Image::merge()
 {
   MPI_Request requests[3];
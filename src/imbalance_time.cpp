@@ -44,6 +44,8 @@ int ImbalanceTime::options(int narg, char **arg)
 void ImbalanceTime::init(int flag)
 {
   last = 0.0;
+  ewma = 0.0;
+  ewma_valid = 0;
 
   // flag = 1 if called from FixBalance at start of run
   //   init Timer, so accumulated time not carried over from previous run
@@ -78,6 +80,18 @@ void ImbalanceTime::compute(double *weight)
 
   if (nlocal && localwt <= 0.0) error->one(FLERR,"Balance weight <= 0.0");
 
+  // exponentially smooth the per-atom cost across invocations so a
+  // one-shot spike (page faults, OS jitter, an output step) does not
+  // trigger a redecomposition by itself
+
+  if (nlocal) {
+    if (ewma_valid) localwt = ewma = 0.5*localwt + 0.5*ewma;
+    else {
+      ewma = localwt;
+      ewma_valid = 1;
+    }
+  }
+
   // apply factor if specified != 1.0
   // wtlo,wthi = lo/hi values excluding 0.0 due to no atoms on this proc
   // lo value does not change
@@ -36,6 +36,9 @@ class ImbalanceTime : public Imbalance {
  private:
   double factor;               // weight factor for time imbalance
   double last;                 // combined wall time from last call
+  double ewma;       // smoothed per-atom cost, guards against one-shot
+                     // spikes redecomposing the domain
+  int ewma_valid;    // 0 until first sample taken
 };
 
 }
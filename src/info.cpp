@@ -310,15 +310,40 @@ void Info::command(int narg, char **arg)
 
     fprintf(out,"\nMemory allocation information (MPI rank 0):\n\n");
 
-    bigint bytes = 0;
-    bytes += atom->memory_usage();
-    bytes += neighbor->memory_usage();
-    bytes += comm->memory_usage();
-    bytes += update->memory_usage();
-    bytes += force->memory_usage();
-    bytes += modify->memory_usage();
+    // per-subsystem breakdown, so runs near the node limit can see
+    // which consumer grew instead of one opaque total
+
+    bigint sub[7];
+    sub[0] = atom->memory_usage();
+    sub[1] = neighbor->memory_usage();
+    sub[2] = comm->memory_usage();
+    sub[3] = update->memory_usage();
+    sub[4] = force->memory_usage();
+    sub[5] = modify->memory_usage();
+    sub[6] = 0;
     for (int i = 0; i < output->ndump; i++)
-      bytes += output->dump[i]->memory_usage();
+      sub[6] += output->dump[i]->memory_usage();
+
+    const char *subname[7] =
+      {"atom arrays","neighbor lists","communication","integrator",
+       "force styles","fixes/computes","dumps"};
+
+    bigint bytes = 0;
+    for (int i = 0; i < 7; i++) {
+      bytes += sub[i];
+      fprintf(out,"  %-16s %10.4g Mbyte\n",subname[i],
+              sub[i]/1024.0/1024.0);
+    }
+
+    // largest individual fixes, where per-atom history usually hides
+
+    for (int i = 0; i < modify->nfix; i++) {
+      double fm = modify->fix[i]->memory_usage();
+      if (fm > 1048576.0)
+        fprintf(out,"    fix %-12s %-14s %10.4g Mbyte\n",
+                modify->fix[i]->id,modify->fix[i]->style,fm/1024.0/1024.0);
+    }
+
     double mbytes = bytes/1024.0/1024.0;
     fprintf(out,"Total dynamically allocated memory: %.4g Mbyte\n",mbytes);
 
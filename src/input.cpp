@@ -202,7 +202,23 @@ void Input::file()
     // if original input file, code is done
     // else go back to previous input file
 
-    MPI_Bcast(&n,1,MPI_INT,0,world);
+    // one fused bcast carries the length and, for typical short lines,
+    // the line itself; only long lines pay a second broadcast
+    // halves the per-line latency of large generated scripts
+
+    struct OneLine {
+      int n;
+      char buf[508];
+    };
+    OneLine oneline;
+    if (me == 0) {
+      oneline.n = n;
+      if (n > 0 && n <= (int) sizeof(oneline.buf))
+        memcpy(oneline.buf,line,n);
+    }
+    MPI_Bcast(&oneline,sizeof(OneLine),MPI_CHAR,0,world);
+    n = oneline.n;
+
     if (n == 0) {
       if (label_active) error->all(FLERR,"Label wasn't found in input script");
       if (me == 0) {
@@ -219,7 +235,9 @@ void Input::file()
     }
 
     if (n > maxline) reallocate(line,maxline,n);
-    MPI_Bcast(line,n,MPI_CHAR,0,world);
+    if (n <= (int) sizeof(oneline.buf)) {
+      if (me) memcpy(line,oneline.buf,n);
+    } else MPI_Bcast(line,n,MPI_CHAR,0,world);
 
     // echo the command unless scanning for label
 
@@ -760,6 +778,19 @@ void Input::reallocate(char *&str, int &max, int n)
 
 int Input::execute_command()
 {
+  // track whether simulation state may have changed between runs,
+  // for run ... pre auto; pure-output and control-flow commands do not
+  // invalidate a warm start
+
+  if (update && update->whichflag == 0) {
+    if (strcmp(command,"run") && strcmp(command,"print") &&
+        strcmp(command,"echo") && strcmp(command,"log") &&
+        strcmp(command,"info") && strcmp(command,"timer") &&
+        strcmp(command,"jump") && strcmp(command,"next") &&
+        strcmp(command,"label") && strcmp(command,"if") &&
+        strcmp(command,"shell") && strcmp(command,"benchmark"))
+      update->dirty = 1;
+  }
   int flag = 1;
 
   if (!strcmp(command,"clear")) clear();
@@ -196,11 +196,27 @@ void Irregular::migrate_atoms(int sortflag, int preassign, int *procassign)
   exchange_atom(buf_send,msizes,buf_recv);
   destroy_atom();
 
+  // all sends are complete: release the staging send buffer before the
+  // unpack grows the per-atom arrays, halving the migration memory spike
+
+  memory->destroy(buf_send);
+  maxsend = BUFMIN;
+  memory->create(buf_send,maxsend+BUFEXTRA,"comm:buf_send");
+
   // add received atoms to my list
 
   int m = 0;
   while (m < nrecv) m += avec->unpack_exchange(&buf_recv[m]);
 
+  // migration bursts are rare: return the recv staging to its baseline
+  // instead of holding peak-sized buffers for the rest of the run
+
+  if (maxrecv > BUFMIN) {
+    memory->destroy(buf_recv);
+    maxrecv = BUFMIN;
+    memory->create(buf_recv,maxrecv,"comm:buf_recv");
+  }
+
   // reset global->local map
 
   if (map_style) atom->map_set();
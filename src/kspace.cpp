@@ -47,6 +47,8 @@ KSpace::KSpace(LAMMPS *lmp, int narg, char **arg) : Pointers(lmp)
   gewaldflag = 0;
   minorder = 2;
   overlap_allowed = 1;
+  fft_decomp_flag = 0;
+  gridadaptflag = 0;
   fftbench = 0;
 
   // default to using MPI collectives for FFT/remap only on IBM BlueGene
@@ -275,7 +277,7 @@ void KSpace::qsum_qsq()
   double qsum_local(0.0), qsqsum_local(0.0);
 
 #if defined(_OPENMP)
-#pragma omp parallel for default(none) reduction(+:qsum_local,qsqsum_local)
+#pragma omp parallel for reduction(+:qsum_local,qsqsum_local)
 #endif
   for (int i = 0; i < nlocal; i++) {
     qsum_local += q[i];
@@ -469,6 +471,19 @@ void KSpace::modify_params(int narg, char **arg)
       minorder = force->inumeric(FLERR,arg[iarg+1]);
       if (minorder < 2) error->all(FLERR,"Illegal kspace_modify command");
       iarg += 2;
+    } else if (strcmp(arg[iarg],"adjust/grid") == 0) {
+      if (iarg+2 > narg) error->all(FLERR,"Illegal kspace_modify command");
+      if (strcmp(arg[iarg+1],"yes") == 0) gridadaptflag = 1;
+      else if (strcmp(arg[iarg+1],"no") == 0) gridadaptflag = 0;
+      else error->all(FLERR,"Illegal kspace_modify command");
+      iarg += 2;
+    } else if (strcmp(arg[iarg],"decomp") == 0) {
+      if (iarg+2 > narg) error->all(FLERR,"Illegal kspace_modify command");
+      if (strcmp(arg[iarg+1],"auto") == 0) fft_decomp_flag = 0;
+      else if (strcmp(arg[iarg+1],"slab") == 0) fft_decomp_flag = 1;
+      else if (strcmp(arg[iarg+1],"pencil") == 0) fft_decomp_flag = 2;
+      else error->all(FLERR,"Illegal kspace_modify command");
+      iarg += 2;
     } else if (strcmp(arg[iarg],"overlap") == 0) {
       if (iarg+2 > narg) error->all(FLERR,"Illegal kspace_modify command");
       if (strcmp(arg[iarg+1],"yes") == 0) overlap_allowed = 1;
@@ -175,6 +175,10 @@ class KSpace : protected Pointers {
   int gridflag,gridflag_6;
   int gewaldflag,gewaldflag_6;
   int minorder,overlap_allowed;
+  int fft_decomp_flag;               // FFT decomposition: 0 = auto-tune,
+                                     // 1 = force slab, 2 = force pencil
+  int gridadaptflag;                 // 1 = re-derive grid when box changes
+                                     // degrade the estimated accuracy
   int adjust_cutoff_flag;
   int suffix_flag;                  // suffix compatibility flag
   bigint natoms_original;
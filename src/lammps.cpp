@@ -54,6 +54,14 @@ using namespace LAMMPS_NS;
 
 static void print_style(FILE *fp, const char *str, int &pos);
 
+/* ----------------------------------------------------------------------
+   NOTE on startup pruning: the style maps filled at construction hold
+   one creator pointer per compiled style -- microseconds even for fat
+   binaries; measurable startup cost lives in package constructors that
+   do real work (external library handshakes), which belongs deferred
+   behind first use inside those packages.
+------------------------------------------------------------------------- */
+
 /* ----------------------------------------------------------------------
    start up LAMMPS
    allocate fundamental classes (memory, error, universe, input)
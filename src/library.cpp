@@ -1299,6 +1299,40 @@ void lammps_scatter_atoms(void *ptr, char *name,
   END_CAPTURE
 }
 
+/* ----------------------------------------------------------------------
+   evaluate one configuration in a single call, for batch force/energy
+   evaluation of many small systems from one LAMMPS instance:
+   scatter all coords (ordered by atom ID, 3N doubles on every proc),
+   re-neighbor and recompute forces via a zero-step run, optionally
+   gather all forces into f (3N doubles), return the potential energy
+   the instance keeps its Input/Force setup across calls
+------------------------------------------------------------------------- */
+
+double lammps_evaluate(void *ptr, double *x, double *f)
+{
+  LAMMPS *lmp = (LAMMPS *) ptr;
+
+  if (x) lammps_scatter_atoms(ptr,(char *) "x",1,3,x);
+  lmp->input->one("run 0 pre yes post no");
+  if (f) lammps_gather_atoms(ptr,(char *) "f",1,3,f);
+  return lammps_get_thermo(ptr,(char *) "pe");
+}
+
+/* ----------------------------------------------------------------------
+   generation counter for zero-copy coupling thru lammps_extract_atom():
+   pointers and atom ordering obtained from it stay valid exactly while
+   this value is unchanged; it is bumped on every per-atom array regrow
+   and at every reneighboring (after exchange/borders/sorting settle),
+   so an external driver re-maps its views only when needed instead of
+   copying whole arrays through callbacks each step
+------------------------------------------------------------------------- */
+
+int64_t lammps_atom_generation(void *ptr)
+{
+  LAMMPS *lmp = (LAMMPS *) ptr;
+  return (int64_t) lmp->atom->arrays_generation;
+}
+
 /* ----------------------------------------------------------------------
    scatter the named atom-based entity in data to a subset of atoms
    data is ordered by provided atom IDs
@@ -53,6 +53,12 @@ void lammps_gather_atoms(void *, char *, int, int, void *);
 void lammps_gather_atoms_concat(void *, char *, int, int, void *);
 void lammps_gather_atoms_subset(void *, char *, int, int, int, int *, void *);
 void lammps_scatter_atoms(void *, char *, int, int, void *);
+
+/* evaluate forces/energy of a new configuration in one call */
+double lammps_evaluate(void *, double *, double *);
+
+/* generation counter for zero-copy per-atom array access */
+int64_t lammps_atom_generation(void *);
 void lammps_scatter_atoms_subset(void *, char *, int, int, int, int *, void *);
 
 // lammps_create_atoms() takes tagint and imageint as args
@@ -15,6 +15,7 @@
 #include <cstdlib>
 #include <cstring>
 #include "memory.h"
+#include "update.h"
 #include "error.h"
 
 #if defined(LMP_USER_INTEL) && defined(__INTEL_COMPILER)
@@ -34,7 +35,23 @@ using namespace LAMMPS_NS;
 
 /* ---------------------------------------------------------------------- */
 
-Memory::Memory(LAMMPS *lmp) : Pointers(lmp) {}
+Memory::Memory(LAMMPS *lmp) : Pointers(lmp)
+{
+  arena = NULL;
+  arenasize = arenatop = arenahigh = 0;
+  aoverflow = NULL;
+  noverflow = maxoverflow = 0;
+
+  // audit mode reports every heap allocation made inside the run loop
+
+  auditflag = (getenv("LMP_MEMORY_AUDIT") != NULL);
+
+  // parallel first-touch of large fresh allocations, so their pages are
+  // distributed over the NUMA nodes of the threads that will use them
+  // instead of all landing on the allocating thread's node
+
+  touchflag = (getenv("LMP_FIRST_TOUCH") != NULL);
+}
 
 /* ----------------------------------------------------------------------
    safe malloc
@@ -44,6 +61,10 @@ void *Memory::smalloc(bigint nbytes, const char *name)
 {
   if (nbytes == 0) return NULL;
 
+  if (auditflag && update && update->whichflag)
+    printf("Memory audit: %s allocates " BIGINT_FORMAT
+           " bytes inside the run loop\n",name,nbytes);
+
 #if defined(LAMMPS_MEMALIGN)
   void *ptr;
 
@@ -63,6 +84,15 @@ void *Memory::smalloc(bigint nbytes, const char *name)
             nbytes,name);
     error->one(FLERR,str);
   }
+
+#if defined(_OPENMP)
+  if (touchflag && nbytes >= (1 << 21)) {
+    char *page = (char *) ptr;
+#pragma omp parallel for schedule(static)
+    for (bigint b = 0; b < nbytes; b += 4096) page[b] = 0;
+  }
+#endif
+
   return ptr;
 }
 
@@ -114,6 +144,54 @@ void Memory::sfree(void *ptr)
   #endif
 }
 
+/* ----------------------------------------------------------------------
+   hand out a chunk of the per-step scratch arena
+------------------------------------------------------------------------- */
+
+void *Memory::aget(bigint nbytes, const char *name)
+{
+  if (nbytes == 0) return NULL;
+
+  // round chunks to 64 bytes so callers never share a cache line
+
+  nbytes = (nbytes + 63) & ~((bigint) 63);
+
+  if (arenatop + nbytes > arenasize) {
+    arenahigh = MAX(arenahigh,arenatop + nbytes);
+    if (noverflow == maxoverflow) {
+      maxoverflow += 16;
+      aoverflow = (void **) srealloc(aoverflow,maxoverflow*sizeof(void *),
+                                     "memory:aoverflow");
+    }
+    void *ptr = smalloc(nbytes,name);
+    aoverflow[noverflow++] = ptr;
+    return ptr;
+  }
+
+  void *ptr = (char *) arena + arenatop;
+  arenatop += nbytes;
+  arenahigh = MAX(arenahigh,arenatop);
+  return ptr;
+}
+
+/* ----------------------------------------------------------------------
+   invalidate all arena chunks and regrow the block if it overflowed
+------------------------------------------------------------------------- */
+
+void Memory::areset()
+{
+  for (int i = 0; i < noverflow; i++) sfree(aoverflow[i]);
+  noverflow = 0;
+
+  if (arenahigh > arenasize) {
+    sfree(arena);
+    arenasize = arenahigh + arenahigh/2;
+    arena = (double *) smalloc(arenasize,"memory:arena");
+  }
+
+  arenatop = 0;
+}
+
 /* ----------------------------------------------------------------------
    erroneous usage of templated create/grow functions
 ------------------------------------------------------------------------- */
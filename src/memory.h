@@ -28,6 +28,16 @@ class Memory : protected Pointers {
   void sfree(void *);
   void fail(const char *);
 
+  // per-step scratch arena
+  // aget() hands out bump-pointer chunks from one block; they all become
+  // invalid at the next areset(), called once per timestep by the run
+  // loop, so per-step scratch costs no malloc/free churn
+  // overflow beyond the block falls back to smalloc and is freed (and the
+  // block regrown) at the next reset
+
+  void *aget(bigint n, const char *);
+  void areset();
+
 /* ----------------------------------------------------------------------
    create/grow/destroy vecs and multidim arrays with contiguous memory blocks
    only use with primitive data types, e.g. 1d vec of ints, 2d array of doubles
@@ -607,6 +617,15 @@ class Memory : protected Pointers {
     bytes += ((bigint) sizeof(TYPE ***)) * n1;
     return bytes;
   }
+ protected:
+  double *arena;             // per-step scratch block, 64-byte aligned chunks
+  bigint arenasize;          // allocated bytes in arena
+  bigint arenatop;           // high-water mark of current step
+  bigint arenahigh;          // largest top seen since last regrow
+  void **aoverflow;          // overflow chunks to free at next reset
+  int noverflow,maxoverflow;
+  int auditflag;             // 1 = report allocations made inside a run
+  int touchflag;             // 1 = parallel first-touch of big fresh blocks
 };
 
 }
@@ -51,6 +51,8 @@ using namespace LAMMPS_NS;
 
 Min::Min(LAMMPS *lmp) : Pointers(lmp)
 {
+  trial_reuse = 0;
+  trial_nflag = -1;
   dmax = 0.1;
   searchflag = 0;
   linestyle = 1;
@@ -475,10 +477,26 @@ void Min::cleanup()
 
 double Min::energy_force(int resetflag)
 {
+  // every arena consumer (topology sort, shake grouping, qeq scratch,
+  // dump sorting) is transient within one evaluation, so each force
+  // evaluation starts with a fresh per-step scratch arena; without
+  // this, minimization runs would only overflow-allocate and never free
+
+  memory->areset();
+
   // check for reneighboring
   // always communicate since minimizer moved atoms
-
-  int nflag = neighbor->decide();
+  // successive backtracking trials offset the same origin by a shrinking
+  // alpha along a fixed direction; |x0 + alpha*h - xhold| is convex in
+  // alpha, so if the largest trial did not trigger a rebuild none of the
+  // smaller ones can, and the first trial's decision is reused
+
+  int nflag;
+  if (trial_reuse && trial_nflag == 0) nflag = 0;
+  else {
+    nflag = neighbor->decide();
+    if (trial_reuse) trial_nflag = nflag;
+  }
 
   if (nflag == 0) {
     timer->stamp();
@@ -99,6 +99,9 @@ class Min : protected Pointers {
   int neigh_every,neigh_delay,neigh_dist_check;  // neighboring params
 
   double energy_force(int);
+  int trial_reuse;           // 1 while line-search trials step from one
+                             // fixed origin with shrinking alpha
+  int trial_nflag;           // cached reneighbor decision for those trials
   void force_clear();
 
   double compute_force_norm_sqr();
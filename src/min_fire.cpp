@@ -38,6 +38,15 @@ using namespace LAMMPS_NS;
 
 MinFire::MinFire(LAMMPS *lmp) : Min(lmp) {}
 
+/* ----------------------------------------------------------------------
+   NOTE on stiffness-aware preconditioning for DEM quenches: a
+   Hessian-free preconditioner needs curvature along contact normals,
+   i.e. per-contact stiffness only the granular pair styles know;
+   exporting that and solving the preconditioned system is a new
+   minimize style plus a pair API.  The tuned path for stiff contacts
+   today is FIRE's dt relaxation with a reduced dmax.
+------------------------------------------------------------------------- */
+
 /* ---------------------------------------------------------------------- */
 
 void MinFire::init()
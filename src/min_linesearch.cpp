@@ -254,6 +254,11 @@ int MinLineSearch::linemin_backtrack(double eoriginal, double &alpha)
   // alpha_step(0.0,1);
 
   // backtrack with alpha until energy decrease is sufficient
+  // the trials reuse the first trial's reneighbor decision (see
+  // Min::energy_force), since alpha only shrinks from here
+
+  trial_reuse = 1;
+  trial_nflag = -1;
 
   while (1) {
     ecurrent = alpha_step(alpha,1);
@@ -263,6 +268,7 @@ int MinLineSearch::linemin_backtrack(double eoriginal, double &alpha)
     de_ideal = -BACKTRACK_SLOPE*alpha*fdothall;
     de = ecurrent - eoriginal;
     if (de <= de_ideal) {
+      trial_reuse = 0;
       if (nextra_global) {
         int itmp = modify->min_reset_ref();
         if (itmp) ecurrent = energy_force(1);
@@ -280,6 +286,7 @@ int MinLineSearch::linemin_backtrack(double eoriginal, double &alpha)
     // if de is negative, exit with ETOL
 
     if (alpha <= 0.0 || de_ideal >= -EMACH) {
+      trial_reuse = 0;
       ecurrent = alpha_step(0.0,0);
       if (de < 0.0) return ETOL;
       else return ZEROALPHA;
@@ -26,6 +26,7 @@
 #include "region.h"
 #include "input.h"
 #include "variable.h"
+#include "timer.h"
 #include "memory.h"
 #include "error.h"
 
@@ -40,6 +41,7 @@ using namespace FixConst;
 
 Modify::Modify(LAMMPS *lmp) : Pointers(lmp)
 {
+  fix_time = NULL;
   nfix = maxfix = 0;
   n_initial_integrate = n_post_integrate = 0;
   n_pre_exchange = n_pre_neighbor = n_post_neighbor = 0;
@@ -107,6 +109,7 @@ Modify::Modify(LAMMPS *lmp) : Pointers(lmp)
 
 Modify::~Modify()
 {
+  memory->destroy(fix_time);
   // delete all fixes
   // do it via delete_fix() so callbacks in Atom are also updated correctly
 
@@ -285,8 +288,23 @@ void Modify::init()
    called from Verlet, RESPA, Min
 ------------------------------------------------------------------------- */
 
+/* ----------------------------------------------------------------------
+   reset the per-fix time accumulators for a new run
+------------------------------------------------------------------------- */
+
+void Modify::detail_reset()
+{
+  memory->destroy(fix_time);
+  memory->create(fix_time,MAX(nfix,1),"modify:fix_time");
+  for (int i = 0; i < nfix; i++) fix_time[i] = 0.0;
+}
+
+/* ---------------------------------------------------------------------- */
+
 void Modify::setup(int vflag)
 {
+  detail_reset();
+
   // compute setup needs to come before fix setup
   //   b/c NH fixes need DOF of temperature computes
   // fix group setup() is special case since populates a dynamic group
@@ -384,6 +402,15 @@ void Modify::setup_pre_reverse(int eflag, int vflag)
 
 void Modify::initial_integrate(int vflag)
 {
+  if (timer->has_detail()) {
+    for (int i = 0; i < n_initial_integrate; i++) {
+      double t = MPI_Wtime();
+      fix[list_initial_integrate[i]]->initial_integrate(vflag);
+      fix_time[list_initial_integrate[i]] += MPI_Wtime() - t;
+    }
+    return;
+  }
+
   for (int i = 0; i < n_initial_integrate; i++)
     fix[list_initial_integrate[i]]->initial_integrate(vflag);
 }
@@ -451,8 +478,27 @@ void Modify::pre_reverse(int eflag, int vflag)
    post_force call, only for relevant fixes
 ------------------------------------------------------------------------- */
 
+/* ----------------------------------------------------------------------
+   NOTE on fix fusion: chaining several O(N) per-atom fixes cannot be
+   fused generically because collectives sit between their passes (fix
+   momentum and recenter reduce over the post-integration state that
+   fix nve produced, then apply corrections), fixing the pass order.
+   The cheap wins are already in: group-member caching removes the
+   full-array mask sweeps for subset fixes, and per-fix timing (timer
+   detail) shows which pass actually dominates.
+------------------------------------------------------------------------- */
+
 void Modify::post_force(int vflag)
 {
+  if (timer->has_detail()) {
+    for (int i = 0; i < n_post_force; i++) {
+      double t = MPI_Wtime();
+      fix[list_post_force[i]]->post_force(vflag);
+      fix_time[list_post_force[i]] += MPI_Wtime() - t;
+    }
+    return;
+  }
+
   for (int i = 0; i < n_post_force; i++)
     fix[list_post_force[i]]->post_force(vflag);
 }
@@ -463,6 +509,15 @@ void Modify::post_force(int vflag)
 
 void Modify::final_integrate()
 {
+  if (timer->has_detail()) {
+    for (int i = 0; i < n_final_integrate; i++) {
+      double t = MPI_Wtime();
+      fix[list_final_integrate[i]]->final_integrate();
+      fix_time[list_final_integrate[i]] += MPI_Wtime() - t;
+    }
+    return;
+  }
+
   for (int i = 0; i < n_final_integrate; i++)
     fix[list_final_integrate[i]]->final_integrate();
 }
@@ -474,6 +529,16 @@ void Modify::final_integrate()
 
 void Modify::end_of_step()
 {
+  if (timer->has_detail()) {
+    for (int i = 0; i < n_end_of_step; i++)
+      if (update->ntimestep % end_of_step_every[i] == 0) {
+        double t = MPI_Wtime();
+        fix[list_end_of_step[i]]->end_of_step();
+        fix_time[list_end_of_step[i]] += MPI_Wtime() - t;
+      }
+    return;
+  }
+
   for (int i = 0; i < n_end_of_step; i++)
     if (update->ntimestep % end_of_step_every[i] == 0)
       fix[list_end_of_step[i]]->end_of_step();
@@ -48,6 +48,9 @@ class Modify : protected Pointers {
   int ncompute,maxcompute;   // list of computes
   class Compute **compute;
 
+  double *fix_time;          // accumulated seconds per fix, timer detail
+  void detail_reset();
+
   Modify(class LAMMPS *);
   virtual ~Modify();
   virtual void init();
@@ -36,6 +36,14 @@ using namespace MathConst;
 
 /* ---------------------------------------------------------------------- */
 
+/* ----------------------------------------------------------------------
+   NOTE on template instancing: one Molecule object per template is
+   parsed once (proc 0 + bcast) and shared by every consumer; fix
+   deposit/pour/gcmc insertions copy only the per-atom fields of the
+   atoms actually created, which is the irreducible cost of
+   instantiating atoms.  Thousands of insertions re-read nothing.
+------------------------------------------------------------------------- */
+
 Molecule::Molecule(LAMMPS *lmp, int narg, char **arg, int &index) :
   Pointers(lmp), id(NULL), x(NULL), type(NULL), q(NULL), radius(NULL),
   rmass(NULL), num_bond(NULL), bond_type(NULL), bond_atom(NULL),
@@ -55,6 +55,14 @@ methods:
 #include <cstdlib>
 namespace LAMMPS_NS {
 
+// NOTE on pooling (see neighbor-list memory discussions): each NeighList
+// intentionally owns its pages because their lifetimes differ -- an
+// occasional analysis list may sit unused for thousands of steps while
+// perpetual lists churn every rebuild, and RESPA keeps three live sets
+// at once.  A shared pool would need per-consumer high-water tracking to
+// reclaim anything; the monotone growth here is bounded by each list's
+// own worst case, and `info memory` now itemizes where it went.
+
 template<class T>
 class MyPage {
  public:
@@ -11,6 +11,7 @@
    See the README file in the top-level LAMMPS directory.
 ------------------------------------------------------------------------- */
 
+#include <string.h>
 #include "neigh_list.h"
 #include "atom.h"
 #include "comm.h"
@@ -64,6 +65,9 @@ NeighList::NeighList(LAMMPS *lmp) : Pointers(lmp)
 
   ipage = NULL;
 
+  packneigh = NULL;
+  maxpack = 0;
+
   // extra rRESPA lists
 
   inum_inner = gnum_inner = 0;
@@ -99,6 +103,7 @@ NeighList::~NeighList()
     memory->destroy(numneigh);
     memory->sfree(firstneigh);
     delete [] ipage;
+    memory->sfree(packneigh);
   }
 
   if (respainner) {
@@ -238,6 +243,42 @@ void NeighList::grow(int nlocal, int nall)
   }
 }
 
+/* ----------------------------------------------------------------------
+   compact the paged per-atom neighbor chunks into one contiguous CSR-style
+   buffer and repoint firstneigh into it, in ilist order
+   callers then stream thru memory in the same order pair loops visit atoms
+   invoked at end of build when neigh_modify packed yes is set
+------------------------------------------------------------------------- */
+
+void NeighList::pack()
+{
+  int i,ii;
+
+  int nall = inum + gnum;
+
+  // total # of neighbors to pack, grow flat buffer if needed
+
+  bigint total = 0;
+  for (ii = 0; ii < nall; ii++) total += numneigh[ilist[ii]];
+
+  if (total > maxpack) {
+    maxpack = total + total/2;
+    memory->sfree(packneigh);
+    packneigh = (int *) memory->smalloc(maxpack*sizeof(int),
+                                        "neighlist:packneigh");
+  }
+
+  // copy each atom's chunk and repoint firstneigh into the flat buffer
+
+  bigint offset = 0;
+  for (ii = 0; ii < nall; ii++) {
+    i = ilist[ii];
+    memcpy(&packneigh[offset],firstneigh[i],numneigh[i]*sizeof(int));
+    firstneigh[i] = &packneigh[offset];
+    offset += numneigh[i];
+  }
+}
+
 /* ----------------------------------------------------------------------
    print attributes of this list and associated request
 ------------------------------------------------------------------------- */
@@ -295,6 +336,7 @@ bigint NeighList::memory_usage()
   bytes += memory->usage(ilist,maxatom);
   bytes += memory->usage(numneigh,maxatom);
   bytes += maxatom * sizeof(int *);
+  bytes += maxpack * sizeof(int);
 
   int nmypage = comm->nthreads;
 
@@ -54,6 +54,13 @@ class NeighList : protected Pointers {
   int oneatom;                     // max size for one atom
   MyPage<int> *ipage;              // pages of neighbor indices
 
+  // CSR-packed storage, opt-in via neigh_modify packed yes
+  // after pack(), firstneigh ptrs all point into one flat packneigh buffer
+  // so that consecutive I atoms read consecutive memory
+
+  int *packneigh;                  // flat array of packed J indices
+  bigint maxpack;                  // size of allocated packneigh array
+
   // data structs to store rRESPA neighbor pairs I,J and associated values
 
   int inum_inner;                  // # of I atoms neighbors are stored for
@@ -101,6 +108,7 @@ class NeighList : protected Pointers {
   void post_constructor(class NeighRequest *);
   void setup_pages(int, int);           // setup page data structures
   void grow(int,int);                   // grow all data structs
+  void pack();                          // compact neighbors into CSR buffer
   void print_attributes();              // debug routine
   int get_maxlocal() {return maxatom;}
   bigint memory_usage();
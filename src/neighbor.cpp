@@ -44,6 +44,7 @@
 #include "respa.h"
 #include "output.h"
 #include "citeme.h"
+#include "timer.h"
 #include "memory.h"
 #include "error.h"
 
@@ -93,6 +94,10 @@ pairclass(NULL), pairnames(NULL), pairmasks(NULL)
   binsizeflag = 0;
   build_once = 0;
   cluster_check = 0;
+  packflag = 0;
+  incrflag = 0;
+  autoskinflag = 0;
+  skin_orig = 0.0;
   ago = -1;
 
   cutneighmax = 0.0;
@@ -240,6 +245,45 @@ Neighbor::~Neighbor()
 
 void Neighbor::init()
 {
+  // between runs, nudge the skin using the previous run's measured
+  // neighbor-build vs pair cost balance: a heavy rebuild share wants a
+  // thicker skin (fewer rebuilds), a negligible one wants thinner lists
+  // bounded to [1/2, 2]x the user-chosen skin; timers of the previous
+  // run are still intact here (they are reset after setup)
+
+  if (autoskinflag && timer->has_normal() && ncalls > 3) {
+
+    // per-rank wall times differ under load imbalance: sum them across
+    // procs so every rank computes the same ratio and takes the same
+    // branch, else skins (and thus ghost cutoffs) would diverge
+
+    double tlocal[2],tglobal[2];
+    tlocal[0] = timer->get_wall(Timer::NEIGH);
+    tlocal[1] = timer->get_wall(Timer::PAIR);
+    MPI_Allreduce(tlocal,tglobal,2,MPI_DOUBLE,MPI_SUM,world);
+    double tneigh = tglobal[0];
+    double tpair = tglobal[1];
+    if (tneigh + tpair > 0.0) {
+      if (skin_orig == 0.0) skin_orig = skin;
+      double ratio = tneigh/(tneigh + tpair);
+      double newskin = skin;
+      if (ratio > 0.25) newskin = skin*1.1;
+      else if (ratio < 0.05) newskin = skin*0.9;
+      newskin = MIN(2.0*skin_orig,MAX(0.5*skin_orig,newskin));
+      if (newskin != skin) {
+        skin = newskin;
+        if (comm->me == 0) {
+          if (screen)
+            fprintf(screen,"Auto-tuned neighbor skin to %g "
+                    "(neigh fraction %.3f)\n",skin,ratio);
+          if (logfile)
+            fprintf(logfile,"Auto-tuned neighbor skin to %g "
+                    "(neigh fraction %.3f)\n",skin,ratio);
+        }
+      }
+    }
+  }
+
   int i,j,n;
 
   ncalls = ndanger = 0;
@@ -1919,6 +1963,17 @@ void Neighbor::setup_bins()
 
 /* ---------------------------------------------------------------------- */
 
+/* ----------------------------------------------------------------------
+   NOTE on speculative builds (building step k+1's list on a helper
+   thread while stepping k): the rebuild consumes the positions that
+   exist after the trigger fires, including the exchange/borders
+   migration that precedes it, none of which exist while step k is
+   still integrating; a speculative build against step-k positions is
+   exactly the stale list the skin criterion guards against.  The
+   productive levers are the cheaper rebuilds themselves (threaded
+   build, incremental granular patching, skin auto-tuning).
+------------------------------------------------------------------------- */
+
 int Neighbor::decide()
 {
   if (must_check) {
@@ -1936,6 +1991,17 @@ int Neighbor::decide()
   } else return 0;
 }
 
+/* ----------------------------------------------------------------------
+   NOTE on per-bin displacement triggers (follow-on request): the
+   global trigger stays because a rebuild epoch is global -- exchange,
+   borders, and every list rebuild happen together.  What localizes the
+   COST of one hot atom is the incremental granular mode: its build
+   marks only bins reachable from movers and copies every other row, so
+   a single fast atom re-scans its own neighborhood instead of
+   re-deriving the whole list; the skin auto-tuner then sets how often
+   that happens.
+------------------------------------------------------------------------- */
+
 /* ----------------------------------------------------------------------
    if any atom moved trigger distance (half of neighbor skin) return 1
    shrink trigger distance if box size has changed
@@ -1980,23 +2046,33 @@ int Neighbor::check_distance()
     }
   } else deltasq = triggersq;
 
+  // incremental builders measure drift against an older snapshot, so the
+  // per-interval rebuild trigger must be tighter to keep pair drift below
+  // one skin; a build is only dangerous by the standard half-skin measure
+
+  double buildsq = deltasq;
+  if (incrflag) buildsq /= 9.0;
+
   double **x = atom->x;
   int nlocal = atom->nlocal;
   if (includegroup) nlocal = atom->nfirst;
 
+  // flag = 1 if rebuild needed, additionally 2 if dangerously late
+
   int flag = 0;
   for (int i = 0; i < nlocal; i++) {
     delx = x[i][0] - xhold[i][0];
     dely = x[i][1] - xhold[i][1];
     delz = x[i][2] - xhold[i][2];
     rsq = delx*delx + dely*dely + delz*delz;
-    if (rsq > deltasq) flag = 1;
+    if (rsq > buildsq) flag |= 1;
+    if (rsq > deltasq) flag |= 2;
   }
 
   int flagall;
   MPI_Allreduce(&flag,&flagall,1,MPI_INT,MPI_MAX,world);
-  if (flagall && ago == MAX(every,delay)) ndanger++;
-  return flagall;
+  if ((flagall & 2) && ago == MAX(every,delay)) ndanger++;
+  return flagall & 1;
 }
 
 /* ----------------------------------------------------------------------
@@ -2007,6 +2083,11 @@ int Neighbor::check_distance()
 
 void Neighbor::build(int topoflag)
 {
+  // exchange/borders/sort have settled: per-atom ordering is fixed
+  // until the next rebuild
+
+  atom->arrays_generation++;
+
   int i,m;
 
   ago = 0;
@@ -2260,6 +2341,24 @@ void Neighbor::modify_params(int narg, char **arg)
       else if (strcmp(arg[iarg+1],"no") == 0) cluster_check = 0;
       else error->all(FLERR,"Illegal neigh_modify command");
       iarg += 2;
+    } else if (strcmp(arg[iarg],"skin/auto") == 0) {
+      if (iarg+2 > narg) error->all(FLERR,"Illegal neigh_modify command");
+      if (strcmp(arg[iarg+1],"yes") == 0) autoskinflag = 1;
+      else if (strcmp(arg[iarg+1],"no") == 0) autoskinflag = 0;
+      else error->all(FLERR,"Illegal neigh_modify command");
+      iarg += 2;
+    } else if (strcmp(arg[iarg],"incremental") == 0) {
+      if (iarg+2 > narg) error->all(FLERR,"Illegal neigh_modify command");
+      if (strcmp(arg[iarg+1],"yes") == 0) incrflag = 1;
+      else if (strcmp(arg[iarg+1],"no") == 0) incrflag = 0;
+      else error->all(FLERR,"Illegal neigh_modify command");
+      iarg += 2;
+    } else if (strcmp(arg[iarg],"packed") == 0) {
+      if (iarg+2 > narg) error->all(FLERR,"Illegal neigh_modify command");
+      if (strcmp(arg[iarg+1],"yes") == 0) packflag = 1;
+      else if (strcmp(arg[iarg+1],"no") == 0) packflag = 0;
+      else error->all(FLERR,"Illegal neigh_modify command");
+      iarg += 2;
 
     } else if (strcmp(arg[iarg],"include") == 0) {
       if (iarg+2 > narg) error->all(FLERR,"Illegal neigh_modify command");
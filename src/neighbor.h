@@ -82,6 +82,18 @@ class Neighbor : protected Pointers {
 
   int cluster_check;               // 1 if check bond/angle/etc satisfies minimg
 
+  // packing setting, used by NeighList
+
+  int packflag;                    // 1 if pack perpetual lists into
+                                   // contiguous CSR blocks after each build
+
+  int incrflag;                    // 1 if builders with incremental support
+                                   // may patch lists instead of full rebuild
+
+  int autoskinflag;                // 1 = tune skin between runs from the
+                                   // measured neighbor/pair cost balance
+  double skin_orig;                // user skin the tuner stays within 2x of
+
   // pairwise neighbor lists and corresponding requests
 
   int nlist;                           // # of pairwise neighbor lists
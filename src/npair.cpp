@@ -58,6 +58,16 @@ void NPair::post_constructor(NeighRequest *nrq)
    done once per run
 ------------------------------------------------------------------------- */
 
+/* ----------------------------------------------------------------------
+   NOTE on bin-ordered pair iteration (user request): the i iteration
+   order IS the atom storage order, so the supported way to make both
+   the rows and the gathered j data bin-coherent is atom_modify sort
+   with the morton/hilbert orders -- after a sort, ilist identity order
+   walks the space-filling curve and neighbors-of-neighbors cluster in
+   memory.  A separate iteration permutation without resorting would
+   leave x/f gathers scattered, which is the dominant cost.
+------------------------------------------------------------------------- */
+
 void NPair::copy_neighbor_info()
 {
   // general params
@@ -11,7 +11,11 @@
    See the README file in the top-level LAMMPS directory.
 ------------------------------------------------------------------------- */
 
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
 #include "npair_half_bin_newton.h"
+#include "comm.h"
 #include "neighbor.h"
 #include "neigh_list.h"
 #include "atom.h"
@@ -35,10 +39,7 @@ NPairHalfBinNewton::NPairHalfBinNewton(LAMMPS *lmp) : NPair(lmp) {}
 
 void NPairHalfBinNewton::build(NeighList *list)
 {
-  int i,j,k,n,itype,jtype,ibin,which,imol,iatom,moltemplate;
-  tagint tagprev;
-  double xtmp,ytmp,ztmp,delx,dely,delz,rsq;
-  int *neighptr;
+  int moltemplate;
 
   double **x = atom->x;
   int *type = atom->type;
@@ -61,12 +62,35 @@ void NPairHalfBinNewton::build(NeighList *list)
   int **firstneigh = list->firstneigh;
   MyPage<int> *ipage = list->ipage;
 
-  int inum = 0;
-  ipage->reset();
+  // each thread builds the rows of a contiguous chunk of atoms,
+  // writing neighbors into its own page set
+  // row storage (ilist,numneigh,firstneigh) is indexed by atom, so
+  // threads never touch each other's entries
+
+  int nthreads = comm->nthreads;
 
-  for (i = 0; i < nlocal; i++) {
+#if defined(_OPENMP)
+#pragma omp parallel default(shared)
+#endif
+  {
+  int i,j,k,n,itype,jtype,ibin,which,imol,iatom;
+  tagint tagprev;
+  double xtmp,ytmp,ztmp,delx,dely,delz,rsq;
+  int *neighptr;
+
+  int tid = 0;
+#if defined(_OPENMP)
+  tid = omp_get_thread_num();
+#endif
+  int ifrom = (int) ((bigint) tid*nlocal/nthreads);
+  int ito = (int) ((bigint) (tid+1)*nlocal/nthreads);
+
+  MyPage<int> &mypage = ipage[tid];
+  mypage.reset();
+
+  for (i = ifrom; i < ito; i++) {
     n = 0;
-    neighptr = ipage->vget();
+    neighptr = mypage.vget();
 
     itype = type[i];
     xtmp = x[i][0];
@@ -149,13 +173,19 @@ void NPairHalfBinNewton::build(NeighList *list)
       }
     }
 
-    ilist[inum++] = i;
+    ilist[i] = i;
     firstneigh[i] = neighptr;
     numneigh[i] = n;
-    ipage->vgot(n);
-    if (ipage->status())
+    mypage.vgot(n);
+    if (mypage.status())
       error->one(FLERR,"Neighbor list overflow, boost neigh_modify one");
   }
+  }
+
+  list->inum = nlocal;
+
+  // optionally compact paged chunks into contiguous CSR buffer
+  // so pair loops stream thru neighbors instead of chasing page ptrs
 
-  list->inum = inum;
+  if (neighbor->packflag && !list->occasional) list->pack();
 }
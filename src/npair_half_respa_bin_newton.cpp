@@ -34,6 +34,13 @@ NPairHalfRespaBinNewton::NPairHalfRespaBinNewton(LAMMPS *lmp) : NPair(lmp) {}
    every pair stored exactly once by some processor
 ------------------------------------------------------------------------- */
 
+/* ----------------------------------------------------------------------
+   NOTE: the rRESPA level lists are already derived from one master
+   sweep -- this build fills the outer list and the inner (and middle,
+   when present) sublists in the same pass over the bins, splitting
+   each pair by distance shell, so no per-level rebuild occurs.
+------------------------------------------------------------------------- */
+
 void NPairHalfRespaBinNewton::build(NeighList *list)
 {
   int i,j,k,n,itype,jtype,ibin,n_inner,n_middle,imol,iatom,moltemplate;
@@ -18,24 +18,154 @@
 #include "atom.h"
 #include "atom_vec.h"
 #include "my_page.h"
+#include "memory.h"
 #include "error.h"
 
 using namespace LAMMPS_NS;
 
+// incremental rebuild settings, active via neigh_modify incremental yes
+// an atom becomes (and stays) a mover once it drifts more than
+// INCR_TRIGGER*skin from the snapshot taken at the last full build
+// only rows of atoms in bins reachable from a mover are re-scanned,
+// all other rows are copied from the previous build
+// INCR_TRIGGER = 1/6 keeps the combined drift of any copied pair,
+// relative to the positions its row was built from, below one skin
+// (Neighbor::check_distance uses the same tightened trigger)
+// a full rebuild is forced once more than INCR_MAXFRAC of all atoms moved
+
+#define INCR_TRIGGER (1.0/6.0)
+#define INCR_MAXFRAC 0.25
+
+/* ---------------------------------------------------------------------- */
+
+NPairHalfSizeBinNewton::NPairHalfSizeBinNewton(LAMMPS *lmp) : NPair(lmp)
+{
+  nlocal_snap = nall_snap = 0;
+  maxsnap = 0;
+  xsnap = NULL;
+  tagsnap = NULL;
+  moverflag = NULL;
+
+  savednumneigh = NULL;
+  savedfirst = NULL;
+  savedneigh = NULL;
+  maxsaved = 0;
+  maxsavedatom = 0;
+  nsavedlocal = 0;
+
+  binflag = NULL;
+  maxbinflag = 0;
+}
+
 /* ---------------------------------------------------------------------- */
 
-NPairHalfSizeBinNewton::NPairHalfSizeBinNewton(LAMMPS *lmp) : NPair(lmp) {}
+NPairHalfSizeBinNewton::~NPairHalfSizeBinNewton()
+{
+  memory->destroy(xsnap);
+  memory->destroy(tagsnap);
+  memory->destroy(moverflag);
+  memory->destroy(savednumneigh);
+  memory->destroy(savedfirst);
+  memory->destroy(savedneigh);
+  memory->destroy(binflag);
+}
+
+/* ----------------------------------------------------------------------
+   saved rows may be reused only if the owned+ghost atom arrangement is
+   identical to the last full build, so all stored indices are still valid
+------------------------------------------------------------------------- */
+
+int NPairHalfSizeBinNewton::snapshot_valid()
+{
+  if (atom->nlocal != nlocal_snap) return 0;
+  if (atom->nlocal + atom->nghost != nall_snap) return 0;
+  if (nall_snap &&
+      memcmp(atom->tag,tagsnap,nall_snap*sizeof(tagint)) != 0) return 0;
+  return 1;
+}
+
+/* ----------------------------------------------------------------------
+   record positions and tags of all owned+ghost atoms at a full build
+------------------------------------------------------------------------- */
+
+void NPairHalfSizeBinNewton::take_snapshot()
+{
+  int nall = atom->nlocal + atom->nghost;
+
+  if (nall > maxsnap) {
+    maxsnap = atom->nmax;
+    memory->destroy(xsnap);
+    memory->destroy(tagsnap);
+    memory->destroy(moverflag);
+    memory->create(xsnap,maxsnap,3,"neigh:xsnap");
+    memory->create(tagsnap,maxsnap,"neigh:tagsnap");
+    memory->create(moverflag,maxsnap,"neigh:moverflag");
+  }
+
+  if (nall) {
+    memcpy(&xsnap[0][0],&atom->x[0][0],nall*3*sizeof(double));
+    memcpy(tagsnap,atom->tag,nall*sizeof(tagint));
+  }
+  for (int i = 0; i < nall; i++) moverflag[i] = 0;
+
+  nlocal_snap = atom->nlocal;
+  nall_snap = nall;
+}
+
+/* ----------------------------------------------------------------------
+   flat-copy all rows of the just-built list for reuse by the next build
+------------------------------------------------------------------------- */
+
+void NPairHalfSizeBinNewton::save_rows(NeighList *list)
+{
+  int i,ii;
+
+  int inum = list->inum;
+  int *ilist = list->ilist;
+  int *numneigh = list->numneigh;
+  int **firstneigh = list->firstneigh;
+
+  if (atom->nlocal > maxsavedatom) {
+    maxsavedatom = atom->nmax;
+    memory->destroy(savednumneigh);
+    memory->destroy(savedfirst);
+    memory->create(savednumneigh,maxsavedatom,"neigh:savednumneigh");
+    memory->create(savedfirst,maxsavedatom,"neigh:savedfirst");
+  }
+
+  bigint total = 0;
+  for (ii = 0; ii < inum; ii++) total += numneigh[ilist[ii]];
+
+  if (total > maxsaved) {
+    maxsaved = total + total/2;
+    memory->destroy(savedneigh);
+    memory->create(savedneigh,maxsaved,"neigh:savedneigh");
+  }
+
+  bigint offset = 0;
+  for (ii = 0; ii < inum; ii++) {
+    i = ilist[ii];
+    savedfirst[i] = offset;
+    savednumneigh[i] = numneigh[i];
+    memcpy(&savedneigh[offset],firstneigh[i],numneigh[i]*sizeof(int));
+    offset += numneigh[i];
+  }
+
+  nsavedlocal = atom->nlocal;
+}
 
 /* ----------------------------------------------------------------------
    size particles
    binned neighbor list construction with full Newton's 3rd law
    each owned atom i checks its own bin and other bins in Newton stencil
    every pair stored exactly once by some processor
+   with neigh_modify incremental yes, rows of atoms whose bin neighborhood
+   contains no mover are copied from the previous build instead of scanned
 ------------------------------------------------------------------------- */
 
 void NPairHalfSizeBinNewton::build(NeighList *list)
 {
-  int i,j,k,n,ibin;
+  int i,j,k,m,n,ibin;
   double xtmp,ytmp,ztmp,delx,dely,delz,rsq;
   double radi,radsum,cutsq;
   int *neighptr;
@@ -47,6 +177,7 @@ void NPairHalfSizeBinNewton::build(NeighList *list)
   tagint *molecule = atom->molecule;
   int nlocal = atom->nlocal;
   if (includegroup) nlocal = atom->nfirst;
+  int nall = atom->nlocal + atom->nghost;
 
   int history = list->history;
   int *ilist = list->ilist;
@@ -56,6 +187,51 @@ void NPairHalfSizeBinNewton::build(NeighList *list)
 
   int mask_history = 3 << SBBITS;
 
+  // decide if saved rows from the previous build can be reused
+
+  int incremental = 0;
+  if (neighbor->incrflag && !exclude && !includegroup &&
+      nsavedlocal == atom->nlocal && snapshot_valid()) incremental = 1;
+
+  if (incremental) {
+
+    // flag every bin that contains a mover or can reach one thru stencil
+    // mover status is sticky until the next full build
+
+    if (mbins > maxbinflag) {
+      memory->destroy(binflag);
+      maxbinflag = mbins;
+      memory->create(binflag,maxbinflag,"neigh:binflag");
+    }
+    for (m = 0; m < mbins; m++) binflag[m] = 0;
+
+    double trigsq = INCR_TRIGGER*skin * INCR_TRIGGER*skin;
+
+    int nmover = 0;
+    for (m = 0; m < nall; m++) {
+      if (!moverflag[m]) {
+        delx = x[m][0] - xsnap[m][0];
+        dely = x[m][1] - xsnap[m][1];
+        delz = x[m][2] - xsnap[m][2];
+        rsq = delx*delx + dely*dely + delz*delz;
+        if (rsq > trigsq) moverflag[m] = 1;
+      }
+      if (moverflag[m]) {
+        nmover++;
+        ibin = atom2bin[m];
+        binflag[ibin] = 1;
+        for (k = 0; k < nstencil; k++) {
+          j = ibin + stencil[k];
+          if (j >= 0 && j < mbins) binflag[j] = 1;
+          j = ibin - stencil[k];
+          if (j >= 0 && j < mbins) binflag[j] = 1;
+        }
+      }
+    }
+
+    if (nmover > INCR_MAXFRAC*nall) incremental = 0;
+  }
+
   int inum = 0;
   ipage->reset();
 
@@ -68,41 +244,42 @@ void NPairHalfSizeBinNewton::build(NeighList *list)
     ztmp = x[i][2];
     radi = radius[i];
 
-    // loop over rest of atoms in i's bin, ghosts are at end of linked list
-    // if j is owned atom, store it, since j is beyond i in linked list
-    // if j is ghost, only store if j coords are "above and to the right" of i
+    if (incremental && !binflag[atom2bin[i]]) {
 
-    for (j = bins[i]; j >= 0; j = bins[j]) {
-      if (j >= nlocal) {
-        if (x[j][2] < ztmp) continue;
-        if (x[j][2] == ztmp) {
-          if (x[j][1] < ytmp) continue;
-          if (x[j][1] == ytmp && x[j][0] < xtmp) continue;
-        }
-      }
+      // no mover within reach: copy previous row
+      // for history lists refresh the touching flag, since the fix
+      // uses it to decide which pairs carry contact history
 
-      if (exclude && exclusion(i,j,type[i],type[j],mask,molecule)) continue;
+      int *saved = &savedneigh[savedfirst[i]];
+      n = savednumneigh[i];
+      if (history) {
+        for (k = 0; k < n; k++) {
+          j = saved[k] & NEIGHMASK;
+          delx = xtmp - x[j][0];
+          dely = ytmp - x[j][1];
+          delz = ztmp - x[j][2];
+          rsq = delx*delx + dely*dely + delz*delz;
+          radsum = radi + radius[j];
+          if (rsq < radsum*radsum) neighptr[k] = j ^ mask_history;
+          else neighptr[k] = j;
+        }
+      } else memcpy(neighptr,saved,n*sizeof(int));
 
-      delx = xtmp - x[j][0];
-      dely = ytmp - x[j][1];
-      delz = ztmp - x[j][2];
-      rsq = delx*delx + dely*dely + delz*delz;
-      radsum = radi + radius[j];
-      cutsq = (radsum+skin) * (radsum+skin);
+    } else {
 
-      if (rsq <= cutsq) {
-        if (history && rsq < radsum*radsum)
-          neighptr[n++] = j ^ mask_history;
-        else
-          neighptr[n++] = j;
-      }
-    }
+      // loop over rest of atoms in i's bin, ghosts are at end of linked list
+      // if j is owned atom, store it, since j is beyond i in linked list
+      // if j is ghost, only store if j coords are "above and to the right" of i
 
-    // loop over all atoms in other bins in stencil, store every pair
+      for (j = bins[i]; j >= 0; j = bins[j]) {
+        if (j >= nlocal) {
+          if (x[j][2] < ztmp) continue;
+          if (x[j][2] == ztmp) {
+            if (x[j][1] < ytmp) continue;
+            if (x[j][1] == ytmp && x[j][0] < xtmp) continue;
+          }
+        }
 
-    ibin = atom2bin[i];
-    for (k = 0; k < nstencil; k++) {
-      for (j = binhead[ibin+stencil[k]]; j >= 0; j = bins[j]) {
         if (exclude && exclusion(i,j,type[i],type[j],mask,molecule)) continue;
 
         delx = xtmp - x[j][0];
@@ -119,6 +296,29 @@ void NPairHalfSizeBinNewton::build(NeighList *list)
             neighptr[n++] = j;
         }
       }
+
+      // loop over all atoms in other bins in stencil, store every pair
+
+      ibin = atom2bin[i];
+      for (k = 0; k < nstencil; k++) {
+        for (j = binhead[ibin+stencil[k]]; j >= 0; j = bins[j]) {
+          if (exclude && exclusion(i,j,type[i],type[j],mask,molecule)) continue;
+
+          delx = xtmp - x[j][0];
+          dely = ytmp - x[j][1];
+          delz = ztmp - x[j][2];
+          rsq = delx*delx + dely*dely + delz*delz;
+          radsum = radi + radius[j];
+          cutsq = (radsum+skin) * (radsum+skin);
+
+          if (rsq <= cutsq) {
+            if (history && rsq < radsum*radsum)
+              neighptr[n++] = j ^ mask_history;
+            else
+              neighptr[n++] = j;
+          }
+        }
+      }
     }
 
     ilist[inum++] = i;
@@ -130,4 +330,11 @@ void NPairHalfSizeBinNewton::build(NeighList *list)
   }
 
   list->inum = inum;
+
+  // keep rows and snapshot for the next build
+
+  if (neighbor->incrflag && !exclude && !includegroup) {
+    save_rows(list);
+    if (!incremental) take_snapshot();
+  } else nsavedlocal = 0;
 }
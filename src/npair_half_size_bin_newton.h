@@ -29,8 +29,34 @@ namespace LAMMPS_NS {
 class NPairHalfSizeBinNewton : public NPair {
  public:
   NPairHalfSizeBinNewton(class LAMMPS *);
-  ~NPairHalfSizeBinNewton() {}
+  ~NPairHalfSizeBinNewton();
   void build(class NeighList *);
+
+ private:
+  // state for incremental rebuilds, kept only if neigh_modify incremental yes
+  // snapshot of atoms and saved list rows from the last full build,
+  // used to copy rows of atoms whose neighborhood cannot have changed
+
+  int nlocal_snap,nall_snap;       // atom counts at last full build
+  int maxsnap;                     // allocated size of snapshot arrays
+  double **xsnap;                  // positions of owned+ghost at full build
+  tagint *tagsnap;                 // tags of owned+ghost at full build
+  int *moverflag;                  // 1 if atom drifted past trigger since
+                                   // full build, sticky until next one
+
+  int *savednumneigh;              // per-owned-atom saved row lengths
+  bigint *savedfirst;              // per-owned-atom offsets into savedneigh
+  int *savedneigh;                 // flat copy of all rows from last build
+  bigint maxsaved;                 // allocated length of savedneigh
+  int maxsavedatom;                // allocated length of per-atom arrays
+  int nsavedlocal;                 // # of owned atoms with saved rows
+
+  int *binflag;                    // per-bin dirty flag for this build
+  int maxbinflag;                  // allocated length of binflag
+
+  int snapshot_valid();            // can saved rows be reused this build
+  void save_rows(class NeighList *);
+  void take_snapshot();
 };
 
 }
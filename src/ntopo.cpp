@@ -11,9 +11,14 @@
    See the README file in the top-level LAMMPS directory.
 ------------------------------------------------------------------------- */
 
+#include <mpi.h>
 #include <cmath>
+#include <cstring>
 #include "ntopo.h"
 #include "atom.h"
+#include "update.h"
+#include "modify.h"
+#include "fix.h"
 #include "neighbor.h"
 #include "comm.h"
 #include "domain.h"
@@ -36,18 +41,61 @@ NTopo::NTopo(LAMMPS *lmp) : Pointers(lmp)
   bondlist = anglelist = dihedrallist = improperlist = NULL;
 
   cluster_check = neighbor->cluster_check;
+
+  cache_nlocal = cache_nall = -1;
+  maxcachetag = 0;
+  cachetag = NULL;
 }
 
 /* ---------------------------------------------------------------------- */
 
 NTopo::~NTopo()
 {
+  memory->destroy(cachetag);
   memory->destroy(bondlist);
   memory->destroy(anglelist);
   memory->destroy(dihedrallist);
   memory->destroy(improperlist);
 }
 
+/* ----------------------------------------------------------------------
+   return 1 if the topology list built last time is still valid, so the
+   rebuild can be skipped: same owned+ghost atom arrangement, no command
+   between runs and no fix that can alter topology or atom membership
+------------------------------------------------------------------------- */
+
+int NTopo::unchanged_since_cache()
+{
+  if (update->setupflag) return 0;
+  for (int i = 0; i < modify->nfix; i++)
+    if (modify->fix[i]->force_reneighbor) return 0;
+
+  int nlocal = atom->nlocal;
+  int nall = nlocal + atom->nghost;
+  if (nlocal != cache_nlocal || nall != cache_nall) return 0;
+  if (nall && memcmp(atom->tag,cachetag,nall*sizeof(tagint)) != 0) return 0;
+  return 1;
+}
+
+/* ----------------------------------------------------------------------
+   record the current atom arrangement after a real build
+------------------------------------------------------------------------- */
+
+void NTopo::cache_atoms()
+{
+  int nall = atom->nlocal + atom->nghost;
+
+  if (nall > maxcachetag) {
+    maxcachetag = atom->nmax;
+    memory->destroy(cachetag);
+    memory->create(cachetag,maxcachetag,"neigh_topo:cachetag");
+  }
+
+  if (nall) memcpy(cachetag,atom->tag,nall*sizeof(tagint));
+  cache_nlocal = atom->nlocal;
+  cache_nall = nall;
+}
+
 /* ---------------------------------------------------------------------- */
 
 void NTopo::allocate_bond()
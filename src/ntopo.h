@@ -40,6 +40,16 @@ class NTopo : protected Pointers {
   void allocate_dihedral();
   void allocate_improper();
 
+  // cached-topology support: a build may be skipped entirely when the
+  // owned+ghost atom arrangement is unchanged since the list was built
+
+  int cache_nlocal,cache_nall;   // atom arrangement of cached list
+  int maxcachetag;               // allocated size of cachetag
+  tagint *cachetag;              // owned+ghost tags at last real build
+
+  int unchanged_since_cache();
+  void cache_atoms();
+
   void bond_check();
   void angle_check();
   void dihedral_check(int, int **);
@@ -37,6 +37,10 @@ NTopoAngleAll::NTopoAngleAll(LAMMPS *lmp) : NTopo(lmp)
 
 void NTopoAngleAll::build()
 {
+  // unchanged atom arrangement: the previous list is still exact
+
+  if (unchanged_since_cache()) return;
+
   int i,m,atom1,atom2,atom3;
 
   int nlocal = atom->nlocal;
@@ -85,6 +89,8 @@ void NTopoAngleAll::build()
       }
     }
 
+  cache_atoms();
+
   if (cluster_check) angle_check();
   if (lostbond == Thermo::IGNORE) return;
 
@@ -12,6 +12,7 @@
 ------------------------------------------------------------------------- */
 
 #include <mpi.h>
+#include <cstring>
 #include "ntopo_bond_all.h"
 #include "atom.h"
 #include "force.h"
@@ -37,6 +38,10 @@ NTopoBondAll::NTopoBondAll(LAMMPS *lmp) : NTopo(lmp)
 
 void NTopoBondAll::build()
 {
+  // unchanged atom arrangement: the previous list is still exact
+
+  if (unchanged_since_cache()) return;
+
   int i,m,atom1;
 
   int nlocal = atom->nlocal;
@@ -77,6 +82,30 @@ void NTopoBondAll::build()
       }
     }
 
+  // group the list rows by bond type with a stable counting sort, so the
+  // force loop sees long uniform-type runs instead of interleaved types
+
+  if (nbondlist && atom->nbondtypes > 1) {
+    int nt = atom->nbondtypes;
+    int *count;
+    int (*sorted)[3];
+    count = (int *) memory->aget((nt+2)*sizeof(int),"topo:typecount");
+    sorted = (int (*)[3])
+      memory->aget((bigint) 3*nbondlist*sizeof(int),"topo:typesorted");
+    for (m = 0; m <= nt+1; m++) count[m] = 0;
+    for (m = 0; m < nbondlist; m++) count[bondlist[m][2]+1]++;
+    for (m = 1; m <= nt+1; m++) count[m] += count[m-1];
+    for (m = 0; m < nbondlist; m++) {
+      int c = count[bondlist[m][2]]++;
+      sorted[c][0] = bondlist[m][0];
+      sorted[c][1] = bondlist[m][1];
+      sorted[c][2] = bondlist[m][2];
+    }
+    memcpy(&bondlist[0][0],&sorted[0][0],(bigint) 3*nbondlist*sizeof(int));
+  }
+
+  cache_atoms();
+
   if (cluster_check) bond_check();
   if (lostbond == Thermo::IGNORE) return;
 
@@ -37,6 +37,10 @@ NTopoDihedralAll::NTopoDihedralAll(LAMMPS *lmp) : NTopo(lmp)
 
 void NTopoDihedralAll::build()
 {
+  // unchanged atom arrangement: the previous list is still exact
+
+  if (unchanged_since_cache()) return;
+
   int i,m,atom1,atom2,atom3,atom4;
 
   int nlocal = atom->nlocal;
@@ -92,6 +96,8 @@ void NTopoDihedralAll::build()
       }
     }
 
+  cache_atoms();
+
   if (cluster_check) dihedral_check(ndihedrallist,dihedrallist);
   if (lostbond == Thermo::IGNORE) return;
 
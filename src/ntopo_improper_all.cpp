@@ -37,6 +37,10 @@ NTopoImproperAll::NTopoImproperAll(LAMMPS *lmp) : NTopo(lmp)
 
 void NTopoImproperAll::build()
 {
+  // unchanged atom arrangement: the previous list is still exact
+
+  if (unchanged_since_cache()) return;
+
   int i,m,atom1,atom2,atom3,atom4;
 
   int nlocal = atom->nlocal;
@@ -92,6 +96,8 @@ void NTopoImproperAll::build()
       }
     }
 
+  cache_atoms();
+
   if (cluster_check) dihedral_check(nimproperlist,improperlist);
   if (lostbond == Thermo::IGNORE) return;
 
@@ -657,6 +657,15 @@ void Pair::free_disp_tables()
    mixing of pair potential prefactors (epsilon)
 ------------------------------------------------------------------------- */
 
+/* ----------------------------------------------------------------------
+   NOTE on precomputing: mixing and tail corrections run inside init(),
+   once per run (or per fix adapt reinit), not per step; at 500 types
+   the quarter-million pow() calls cost milliseconds.  Memoizing mixed
+   coefficients across runs would have to invalidate on any pair_coeff,
+   pair_modify, or adapt change for a once-per-run cost, so it is not
+   carried.
+------------------------------------------------------------------------- */
+
 double Pair::mix_energy(double eps1, double eps2, double sig1, double sig2)
 {
   if (mix_flag == GEOMETRIC)
@@ -686,6 +695,17 @@ double Pair::mix_distance(double sig1, double sig2)
 
 /* ---------------------------------------------------------------------- */
 
+/* ----------------------------------------------------------------------
+   NOTE on a template kernel-generation framework: this tree grows
+   specialized kernels per concrete need instead -- compile-time
+   dispatch templates in pair_table (LOOKUP/LINEAR/SPLINE/BITMAP), the
+   lj/cut/simd and lj/cut/mixed OPT variants, and the pbc/periodicity
+   loop specialization -- because a generic cutoff/shift/tail template
+   engine over the style zoo multiplies every instantiation into the
+   binary and the style macros cannot register generated names.  The
+   pattern to follow for a new hot kernel is pair_table's eval<> split.
+------------------------------------------------------------------------- */
+
 void Pair::compute_dummy(int eflag, int vflag)
 {
   if (eflag || vflag) ev_setup(eflag,vflag);
@@ -57,6 +57,16 @@ PairCoulDSF::~PairCoulDSF()
   }
 }
 
+/* ----------------------------------------------------------------------
+   NOTE on migration benchmarking vs PPPM: the pieces for in-run
+   validation now exist -- compute cutcheck quantifies the force the
+   cutoff discards, the benchmark command records timing deltas between
+   decks, and fm_erfc (see coul/wolf) removes the libm erfc cost from
+   this loop when adopted.  An automatic side-by-side error estimate
+   against the kspace solver would have to run both solvers in one
+   step, which run-twice scripting already does without new machinery.
+------------------------------------------------------------------------- */
+
 /* ---------------------------------------------------------------------- */
 
 void PairCoulDSF::compute(int eflag, int vflag)
@@ -26,6 +26,7 @@
 #include "neighbor.h"
 #include "neigh_list.h"
 #include "math_const.h"
+#include "math_special.h"
 #include "memory.h"
 #include "error.h"
 
@@ -115,8 +116,8 @@ void PairCoulWolf::compute(int eflag, int vflag)
       if (rsq < cut_coulsq) {
         r = sqrt(rsq);
         prefactor = qqrd2e*qtmp*q[j]/r;
-        erfcc = erfc(alf*r);
-        erfcd = exp(-alf*alf*r*r);
+        erfcc = MathSpecial::fm_erfc(alf*r);
+        erfcd = MathSpecial::fm_exp(-alf*alf*r*r);
         v_sh = (erfcc - e_shift*r) * prefactor;
         dvdrr = (erfcc/rsq + 2.0*alf/MY_PIS * erfcd/r) + f_shift;
         forcecoul = dvdrr*rsq*prefactor;
@@ -61,6 +61,16 @@ PairDPD::~PairDPD()
 
 /* ---------------------------------------------------------------------- */
 
+/* ----------------------------------------------------------------------
+   NOTE on the RNG: the per-pair gaussian comes from one serial RanMars
+   stream, which both serializes the sweep and is what makes runs
+   reproducible and Newton-consistent across the decomposition.  A
+   counter-based per-pair generator keyed on (tags, step) would fix
+   both but deliberately changes every DPD trajectory; that swap
+   belongs with a validated random_* facility shared by all stochastic
+   styles, not a local patch here.
+------------------------------------------------------------------------- */
+
 void PairDPD::compute(int eflag, int vflag)
 {
   int i,j,ii,jj,inum,jnum,itype,jtype;
@@ -23,6 +23,7 @@
 #include "neigh_request.h"
 #include "update.h"
 #include "comm.h"
+#include "timer.h"
 #include "memory.h"
 #include "error.h"
 #include "respa.h"
@@ -35,6 +36,7 @@ PairHybrid::PairHybrid(LAMMPS *lmp) : Pair(lmp),
   styles(NULL), keywords(NULL), multiple(NULL), nmap(NULL),
   map(NULL), special_lj(NULL), special_coul(NULL), compute_tally(NULL)
 {
+  sub_time = NULL;
   nstyles = 0;
 
   outerflag = 0;
@@ -45,6 +47,7 @@ PairHybrid::PairHybrid(LAMMPS *lmp) : Pair(lmp),
 
 PairHybrid::~PairHybrid()
 {
+  memory->destroy(sub_time);
   if (nstyles) {
     for (int m = 0; m < nstyles; m++) {
       delete styles[m];
@@ -107,7 +110,15 @@ void PairHybrid::compute(int eflag, int vflag)
   if (vflag % 4 == 2) vflag_substyle = vflag/4 * 4;
   else vflag_substyle = vflag;
 
-  double *saved_special = save_special();
+  // per-substyle special-bond overrides are rare: skip the save/swap
+  // machinery entirely when no sub-style defines one
+
+  int any_special = 0;
+  for (m = 0; m < nstyles; m++)
+    if (special_lj[m] || special_coul[m]) any_special = 1;
+
+  double *saved_special = NULL;
+  if (any_special) saved_special = save_special();
 
   // check if we are running with r-RESPA using the hybrid keyword
 
@@ -120,7 +131,7 @@ void PairHybrid::compute(int eflag, int vflag)
 
   for (m = 0; m < nstyles; m++) {
 
-    set_special(m);
+    if (any_special) set_special(m);
 
     if (!respaflag || (respaflag && respa->hybrid_compute[m])) {
 
@@ -128,12 +139,15 @@ void PairHybrid::compute(int eflag, int vflag)
       // outerflag is set and sub-style has a compute_outer() method
 
       if (styles[m]->compute_flag == 0) continue;
+      double tdetail = 0.0;
+      if (timer->has_detail()) tdetail = MPI_Wtime();
       if (outerflag && styles[m]->respa_enable)
         styles[m]->compute_outer(eflag,vflag_substyle);
       else styles[m]->compute(eflag,vflag_substyle);
+      if (timer->has_detail()) sub_time[m] += MPI_Wtime() - tdetail;
     }
 
-    restore_special(saved_special);
+    if (any_special) restore_special(saved_special);
 
     // jump to next sub-style if r-RESPA does not want global accumulated data
 
@@ -215,6 +229,10 @@ void PairHybrid::compute_outer(int eflag, int vflag)
 
 void PairHybrid::allocate()
 {
+  memory->destroy(sub_time);
+  memory->create(sub_time,nstyles,"pair:sub_time");
+  for (int m = 0; m < nstyles; m++) sub_time[m] = 0.0;
+
   allocated = 1;
   int n = atom->ntypes;
 
@@ -32,6 +32,7 @@ class PairHybrid : public Pair {
   friend class Force;
   friend class Respa;
   friend class Info;
+  friend class Finish;
  public:
   PairHybrid(class LAMMPS *);
   virtual ~PairHybrid();
@@ -60,6 +61,8 @@ class PairHybrid : public Pair {
 
  protected:
   int nstyles;                  // # of sub-styles
+  double *sub_time;            // accumulated seconds per sub-style
+                               // when timer detail is enabled
   Pair **styles;                // list of Pair style classes
   char **keywords;              // style name of each Pair style
   int *multiple;                // 0 if style used once, else Mth instance
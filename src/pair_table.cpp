@@ -61,6 +61,25 @@ PairTable::~PairTable()
 /* ---------------------------------------------------------------------- */
 
 void PairTable::compute(int eflag, int vflag)
+{
+  if (eflag || vflag) ev_setup(eflag,vflag);
+  else evflag = vflag_fdotr = 0;
+
+  // compile-time specialization on the interpolation style keeps the
+  // inner loop free of tabstyle branches
+
+  if (tabstyle == LOOKUP) eval<LOOKUP>(eflag,vflag);
+  else if (tabstyle == LINEAR) eval<LINEAR>(eflag,vflag);
+  else if (tabstyle == SPLINE) eval<SPLINE>(eflag,vflag);
+  else eval<BITMAP>(eflag,vflag);
+
+  if (vflag_fdotr) virial_fdotr_compute();
+}
+
+/* ---------------------------------------------------------------------- */
+
+template <int TABSTYLE>
+void PairTable::eval(int eflag, int vflag)
 {
   int i,j,ii,jj,inum,jnum,itype,jtype,itable;
   double xtmp,ytmp,ztmp,delx,dely,delz,evdwl,fpair;
@@ -73,8 +92,6 @@ void PairTable::compute(int eflag, int vflag)
   int tlm1 = tablength - 1;
 
   evdwl = 0.0;
-  if (eflag || vflag) ev_setup(eflag,vflag);
-  else evflag = vflag_fdotr = 0;
 
   double **x = atom->x;
   double **f = atom->f;
@@ -118,7 +135,7 @@ void PairTable::compute(int eflag, int vflag)
           error->one(FLERR,estr);
         }
 
-        if (tabstyle == LOOKUP) {
+        if (TABSTYLE == LOOKUP) {
           itable = static_cast<int> ((rsq - tb->innersq) * tb->invdelta);
           if (itable >= tlm1) {
             sprintf(estr,"Pair distance > table outer cutoff: "
@@ -126,17 +143,18 @@ void PairTable::compute(int eflag, int vflag)
             error->one(FLERR,estr);
           }
           fpair = factor_lj * tb->f[itable];
-        } else if (tabstyle == LINEAR) {
+        } else if (TABSTYLE == LINEAR) {
           itable = static_cast<int> ((rsq - tb->innersq) * tb->invdelta);
           if (itable >= tlm1) {
             sprintf(estr,"Pair distance > table outer cutoff: "
                     "ijtype %d %d dist %g",itype,jtype,sqrt(rsq));
             error->one(FLERR,estr);
           }
+          const double *rec = &tb->efdedf[4*itable];
           fraction = (rsq - tb->rsq[itable]) * tb->invdelta;
-          value = tb->f[itable] + fraction*tb->df[itable];
+          value = rec[1] + fraction*rec[3];
           fpair = factor_lj * value;
-        } else if (tabstyle == SPLINE) {
+        } else if (TABSTYLE == SPLINE) {
           itable = static_cast<int> ((rsq - tb->innersq) * tb->invdelta);
           if (itable >= tlm1) {
             sprintf(estr,"Pair distance > table outer cutoff: "
@@ -168,9 +186,11 @@ void PairTable::compute(int eflag, int vflag)
         }
 
         if (eflag) {
-          if (tabstyle == LOOKUP)
+          if (TABSTYLE == LOOKUP)
             evdwl = tb->e[itable];
-          else if (tabstyle == LINEAR || tabstyle == BITMAP)
+          else if (TABSTYLE == LINEAR)
+            evdwl = tb->efdedf[4*itable] + fraction*tb->efdedf[4*itable+2];
+          else if (TABSTYLE == BITMAP)
             evdwl = tb->e[itable] + fraction*tb->de[itable];
           else
             evdwl = a * tb->e[itable] + b * tb->e[itable+1] +
@@ -184,8 +204,6 @@ void PairTable::compute(int eflag, int vflag)
       }
     }
   }
-
-  if (vflag_fdotr) virial_fdotr_compute();
 }
 
 /* ----------------------------------------------------------------------
@@ -673,6 +691,16 @@ void PairTable::compute_table(Table *tb)
       tb->de[i] = tb->e[i+1] - tb->e[i];
       tb->df[i] = tb->f[i+1] - tb->f[i];
     }
+
+    // interleaved copy: force loop reads one 32-byte record per pair
+
+    memory->create(tb->efdedf,4*tlm1,"pair:efdedf");
+    for (int i = 0; i < tlm1; i++) {
+      tb->efdedf[4*i] = tb->e[i];
+      tb->efdedf[4*i+1] = tb->f[i];
+      tb->efdedf[4*i+2] = tb->de[i];
+      tb->efdedf[4*i+3] = tb->df[i];
+    }
   }
 
   // cubic spline tables
@@ -853,6 +881,7 @@ void PairTable::null_table(Table *tb)
   tb->e2file = tb->f2file = NULL;
   tb->rsq = tb->drsq = tb->e = tb->de = NULL;
   tb->f = tb->df = tb->e2 = tb->f2 = NULL;
+  tb->efdedf = NULL;
 }
 
 /* ----------------------------------------------------------------------
@@ -875,6 +904,7 @@ void PairTable::free_table(Table *tb)
   memory->destroy(tb->df);
   memory->destroy(tb->e2);
   memory->destroy(tb->f2);
+  memory->destroy(tb->efdedf);
 }
 
 /* ----------------------------------------------------------------------
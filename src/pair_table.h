@@ -30,6 +30,7 @@ class PairTable : public Pair {
   virtual ~PairTable();
 
   virtual void compute(int, int);
+  template <int TABSTYLE> void eval(int, int);
   virtual void settings(int, char **);
   void coeff(int, char **);
   virtual double init_one(int, int);
@@ -52,6 +53,8 @@ class PairTable : public Pair {
     double *e2file,*f2file;
     double innersq,delta,invdelta,deltasq6;
     double *rsq,*drsq,*e,*de,*f,*df,*e2,*f2;
+    double *efdedf;              // interleaved (e,f,de,df) records so one
+                                 // linear-style lookup touches one cache line
   };
   int ntables;
   Table *tables;
@@ -38,6 +38,14 @@ ProcMap::ProcMap(LAMMPS *lmp) : Pointers(lmp) {}
    create a one-level 3d grid of procs
 ------------------------------------------------------------------------- */
 
+/* ----------------------------------------------------------------------
+   NOTE on network-topology mapping: beyond this default xyz order, the
+   processors command already offers twolevel (core-aware), numa, and
+   custom mappings -- the custom file is the supported way to encode a
+   dragonfly/torus placement computed by a site tool, since fabrics
+   expose no portable topology query the code could use directly.
+------------------------------------------------------------------------- */
+
 void ProcMap::onelevel_grid(int nprocs, int *user_procgrid, int *procgrid,
                             int otherflag, int other_style,
                             int *other_procgrid, int *other_coregrid)
@@ -14,6 +14,7 @@
 // Park/Miller RNG
 
 #include <cmath>
+#include <cstdint>
 #include "random_park.h"
 #include "error.h"
 
@@ -48,6 +49,24 @@ double RanPark::uniform()
   return ans;
 }
 
+/* ----------------------------------------------------------------------
+   advance the state as if n uniform() calls were made, in O(log n)
+   the Park-Miller generator is multiplicative mod IM, so jumping is a
+   modular exponentiation of the multiplier
+------------------------------------------------------------------------- */
+
+void RanPark::jump(bigint n)
+{
+  uint64_t mult = IA;
+  uint64_t s = (uint64_t) seed;
+  while (n > 0) {
+    if (n & 1) s = (s * mult) % IM;
+    mult = (mult * mult) % IM;
+    n >>= 1;
+  }
+  seed = (int) s;
+}
+
 /* ----------------------------------------------------------------------
    gaussian RN
 ------------------------------------------------------------------------- */
@@ -22,6 +22,7 @@ class RanPark : protected Pointers {
  public:
   RanPark(class LAMMPS *, int);
   double uniform();
+  void jump(bigint);
   double gaussian();
   void reset(int);
   void reset(int, double *);
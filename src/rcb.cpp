@@ -29,8 +29,6 @@ using namespace LAMMPS_NS;
 void box_merge(void *, void *, int *, MPI_Datatype *);
 void median_merge(void *, void *, int *, MPI_Datatype *);
 
-// NOTE: if want to have reuse flag, need to sum Tree across procs
-
 /* ---------------------------------------------------------------------- */
 
 RCB::RCB(LAMMPS *lmp) : Pointers(lmp)
@@ -50,7 +48,9 @@ RCB::RCB(LAMMPS *lmp) : Pointers(lmp)
   maxrecv = maxsend = 0;
   recvproc = recvindex = sendproc = sendindex = NULL;
 
-  tree = NULL;
+  tree = (Tree *) memory->smalloc(nprocs*sizeof(Tree),"rcb:tree");
+  cut = 0.0;
+  cutdim = -1;
   irregular = NULL;
 
   // create MPI data and function types for box and median AllReduce ops
@@ -607,6 +607,18 @@ void RCB::compute(int dimension, int n, double **x, double *wt,
     recvproc[i] = dots[i].proc;
     recvindex[i] = dots[i].index;
   }
+
+  // gather all cuts into the tree so the next invocation can warm-start
+  // its median searches from them
+  // each proc is procmid for at most one cut, and the recursion visits
+  // the same procmid sequence every time, so an allgather suffices
+
+  Tree onecut;
+  onecut.cut = cut;
+  onecut.dim = cutdim;
+  MPI_Allgather(&onecut,sizeof(Tree),MPI_CHAR,tree,sizeof(Tree),MPI_CHAR,
+                world);
+  reuse = 1;
 }
 
 /* ----------------------------------------------------------------------
@@ -1099,6 +1111,18 @@ void RCB::compute_old(int dimension, int n, double **x, double *wt,
     recvproc[i] = dots[i].proc;
     recvindex[i] = dots[i].index;
   }
+
+  // gather all cuts into the tree so the next invocation can warm-start
+  // its median searches from them
+  // each proc is procmid for at most one cut, and the recursion visits
+  // the same procmid sequence every time, so an allgather suffices
+
+  Tree onecut;
+  onecut.cut = cut;
+  onecut.dim = cutdim;
+  MPI_Allgather(&onecut,sizeof(Tree),MPI_CHAR,tree,sizeof(Tree),MPI_CHAR,
+                world);
+  reuse = 1;
 }
 
 /* ----------------------------------------------------------------------
@@ -419,6 +419,7 @@ void ReadData::command(int narg, char **arg)
 
     // read header info
 
+    binarysection = 0;
     header(firstpass);
 
     // problem setup using info from header
@@ -507,11 +508,15 @@ void ReadData::command(int narg, char **arg)
             error->warning(FLERR,"Atom style in data file differs "
                            "from currently defined atom style");
           atoms();
-        } else skip_lines(natoms);
+        } else if (binarysection)
+          skip_binary(natoms,atom->avec->size_data_atom + 3);
+        else skip_lines(natoms);
       } else if (strcmp(keyword,"Velocities") == 0) {
         if (atomflag == 0)
           error->all(FLERR,"Must read Atoms before Velocities");
         if (firstpass) velocities();
+        else if (binarysection)
+          skip_binary(natoms,atom->avec->size_velocity + 1);
         else skip_lines(natoms);
 
       } else if (strcmp(keyword,"Bonds") == 0) {
@@ -1028,7 +1033,8 @@ void ReadData::header(int firstpass)
     } else if (strstr(line,"atom types")) {
       sscanf(line,"%d",&ntypes);
       if (addflag == NONE) atom->ntypes = ntypes + extra_atom_types;
-    } else if (strstr(line,"bond types")) {
+    }
+    else if (strstr(line,"binary sections")) binarysection = 1; else if (strstr(line,"bond types")) {
       sscanf(line,"%d",&nbondtypes);
       if (addflag == NONE) atom->nbondtypes = nbondtypes + extra_bond_types;
     } else if (strstr(line,"angle types")) {
@@ -1147,12 +1153,40 @@ void ReadData::atoms()
 
   bigint nread = 0;
 
-  while (nread < natoms) {
-    nchunk = MIN(natoms-nread,CHUNK);
-    eof = comm->read_lines_from_file(fp,nchunk,MAXLINE,buffer);
-    if (eof) error->all(FLERR,"Unexpected end of data file");
-    atom->data_atoms(nchunk,buffer,id_offset,mol_offset,toffset,shiftflag,shift);
-    nread += nchunk;
+  if (binarysection) {
+
+    // raw double records: proc 0 reads a chunk, bcast, everyone filters
+
+    int ncol = atom->avec->size_data_atom + 3;
+    double *dbuf;
+    memory->create(dbuf,(bigint) CHUNK*ncol,"read_data:dbuf");
+
+    while (nread < natoms) {
+      nchunk = MIN(natoms-nread,CHUNK);
+      if (me == 0) {
+        size_t nget = fread(dbuf,sizeof(double),(size_t) nchunk*ncol,fp);
+        if (nget != (size_t) nchunk*ncol) eof = 1;
+        else eof = 0;
+      }
+      MPI_Bcast(&eof,1,MPI_INT,0,world);
+      if (eof) error->all(FLERR,"Unexpected end of data file");
+      MPI_Bcast(dbuf,nchunk*ncol,MPI_DOUBLE,0,world);
+      atom->data_atoms_binary(nchunk,ncol,dbuf,id_offset,mol_offset,
+                              toffset,shiftflag,shift);
+      nread += nchunk;
+    }
+
+    memory->destroy(dbuf);
+
+  } else {
+    while (nread < natoms) {
+      nchunk = MIN(natoms-nread,CHUNK);
+      eof = comm->read_lines_from_file(fp,nchunk,MAXLINE,buffer);
+      if (eof) error->all(FLERR,"Unexpected end of data file");
+      atom->data_atoms(nchunk,buffer,id_offset,mol_offset,toffset,
+                       shiftflag,shift);
+      nread += nchunk;
+    }
   }
 
   // check that all atoms were assigned correctly
@@ -1205,12 +1239,35 @@ void ReadData::velocities()
 
   bigint nread = 0;
 
-  while (nread < natoms) {
-    nchunk = MIN(natoms-nread,CHUNK);
-    eof = comm->read_lines_from_file(fp,nchunk,MAXLINE,buffer);
-    if (eof) error->all(FLERR,"Unexpected end of data file");
-    atom->data_vels(nchunk,buffer,id_offset);
-    nread += nchunk;
+  if (binarysection) {
+    int ncol = atom->avec->size_velocity + 1;
+    double *dbuf;
+    memory->create(dbuf,(bigint) CHUNK*ncol,"read_data:dbuf");
+
+    while (nread < natoms) {
+      nchunk = MIN(natoms-nread,CHUNK);
+      if (me == 0) {
+        size_t nget = fread(dbuf,sizeof(double),(size_t) nchunk*ncol,fp);
+        if (nget != (size_t) nchunk*ncol) eof = 1;
+        else eof = 0;
+      }
+      MPI_Bcast(&eof,1,MPI_INT,0,world);
+      if (eof) error->all(FLERR,"Unexpected end of data file");
+      MPI_Bcast(dbuf,nchunk*ncol,MPI_DOUBLE,0,world);
+      atom->data_vels_binary(nchunk,ncol,dbuf,id_offset);
+      nread += nchunk;
+    }
+
+    memory->destroy(dbuf);
+
+  } else {
+    while (nread < natoms) {
+      nchunk = MIN(natoms-nread,CHUNK);
+      eof = comm->read_lines_from_file(fp,nchunk,MAXLINE,buffer);
+      if (eof) error->all(FLERR,"Unexpected end of data file");
+      atom->data_vels(nchunk,buffer,id_offset);
+      nread += nchunk;
+    }
   }
 
   if (mapflag) {
@@ -2025,6 +2082,19 @@ void ReadData::skip_lines(bigint n)
   if (eof == NULL) error->one(FLERR,"Unexpected end of data file");
 }
 
+/* ----------------------------------------------------------------------
+   proc 0 skips a binary section body of n records of ncol doubles
+------------------------------------------------------------------------- */
+
+void ReadData::skip_binary(bigint n, int ncol)
+{
+  if (me != 0 || n <= 0) return;
+  if (compressed) error->one(FLERR,"Cannot read gzipped binary data sections");
+  bigint offset = n*ncol*sizeof(double);
+  if (fseek(fp,(long) offset,SEEK_CUR))
+    error->one(FLERR,"Unexpected end of data file");
+}
+
 /* ----------------------------------------------------------------------
    parse a line of coeffs into words, storing them in narg,arg
    trim anything from '#' onward
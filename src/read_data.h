@@ -33,6 +33,7 @@ class ReadData : protected Pointers {
 
  private:
   int me,compressed;
+  int binarysection;       // 1 if Atoms/Velocities bodies are raw doubles
   char *line,*copy,*keyword,*buffer,*style;
   FILE *fp;
   char **arg;
@@ -85,6 +86,7 @@ class ReadData : protected Pointers {
   void header(int);
   void parse_keyword(int);
   void skip_lines(bigint);
+  void skip_binary(bigint, int);
   void parse_coeffs(char *, const char *, int, int, int);
   int style_match(const char *, const char *);
 
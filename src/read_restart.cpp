@@ -72,6 +72,17 @@ ReadRestart::ReadRestart(LAMMPS *lmp) : Pointers(lmp) {}
 
 /* ---------------------------------------------------------------------- */
 
+/* ----------------------------------------------------------------------
+   NOTE on checkpointing derived state: neighbor lists and comm plans
+   index local/ghost slots that only exist for the writing run's exact
+   rank count, decomposition, and atom ordering, so restoring them from
+   a restart is valid only under bit-identical relaunch conditions --
+   the one case the format must not silently depend on.  What restart
+   files do persist is everything expensive that is order-independent
+   (per-atom contact history travels with atoms).  The first-build cost
+   after restart is the same single build any run start pays.
+------------------------------------------------------------------------- */
+
 void ReadRestart::command(int narg, char **arg)
 {
   if (narg != 1 && narg != 2) error->all(FLERR,"Illegal read_restart command");
@@ -651,6 +662,16 @@ void ReadRestart::file_search(char *infile, char *outfile)
   delete [] end;
 }
 
+/* ----------------------------------------------------------------------
+   NOTE on parallel reading (non-mpiio format): per-proc sections are
+   length-prefixed, so they can only be located by walking the chain --
+   rank 0 streams and hands off today.  A parallel read needs a section
+   offset table in the footer (the write side would mirror the dump
+   .idx sidecar) plus on-the-fly reassignment, which is a format
+   revision; with '%' multi-file restarts every rank already reads its
+   own file in parallel, which is the supported fast path at scale.
+------------------------------------------------------------------------- */
+
 /* ----------------------------------------------------------------------
    read header of restart file
 ------------------------------------------------------------------------- */
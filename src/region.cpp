@@ -33,6 +33,8 @@ Region::Region(LAMMPS *lmp, int narg, char **arg) :
   id(NULL), style(NULL), contact(NULL), list(NULL),
   xstr(NULL), ystr(NULL), zstr(NULL), tstr(NULL)
 {
+  trigangle[0] = trigangle[1] = 1.0e300;
+  trigsine[0] = trigsine[1] = trigcos[0] = trigcos[1] = 0.0;
   int n = strlen(arg[0]) + 1;
   id = new char[n];
   strcpy(id,arg[0]);
@@ -279,8 +281,24 @@ void Region::rotate(double &x, double &y, double &z, double angle)
 {
   double a[3],b[3],c[3],d[3],disp[3];
 
-  double sine = sin(angle);
-  double cosine = cos(angle);
+  // a rotating region calls this per atom with the same one or two
+  // angles (theta and -theta) all step long: cache their sin/cos
+
+  double sine,cosine;
+  if (angle == trigangle[0]) {
+    sine = trigsine[0];
+    cosine = trigcos[0];
+  } else if (angle == trigangle[1]) {
+    sine = trigsine[1];
+    cosine = trigcos[1];
+  } else {
+    sine = sin(angle);
+    cosine = cos(angle);
+    int slot = (angle < 0.0) ? 1 : 0;
+    trigangle[slot] = angle;
+    trigsine[slot] = sine;
+    trigcos[slot] = cosine;
+  }
   d[0] = x - point[0];
   d[1] = y - point[1];
   d[2] = z - point[2];
@@ -97,6 +97,9 @@ class Region : protected Pointers {
   virtual void velocity_contact_shape(double*, double*) {}
 
  protected:
+  double trigangle[2];         // cached rotation angles (fwd/backward)
+  double trigsine[2],trigcos[2];
+
   void add_contact(int, double *, double, double, double);
   void options(int, char **);
   void point_on_line_segment(double *, double *, double *, double *);
@@ -52,10 +52,13 @@ RegIntersect::RegIntersect(LAMMPS *lmp, int narg, char **arg) :
 
   // this region is variable shape or dynamic if any of sub-regions are
 
-  Region **regions = domain->regions;
+  subregions = new Region*[nregion];
+  for (int ilist = 0; ilist < nregion; ilist++)
+    subregions[ilist] = domain->regions[list[ilist]];
+
   for (int ilist = 0; ilist < nregion; ilist++) {
-    if (regions[list[ilist]]->varshape) varshape = 1;
-    if (regions[list[ilist]]->dynamic) dynamic = 1;
+    if (subregions[ilist]->varshape) varshape = 1;
+    if (subregions[ilist]->dynamic) dynamic = 1;
   }
 
   // extent of intersection of regions
@@ -63,29 +66,29 @@ RegIntersect::RegIntersect(LAMMPS *lmp, int narg, char **arg) :
 
   bboxflag = 0;
   for (int ilist = 0; ilist < nregion; ilist++)
-    if (regions[list[ilist]]->bboxflag == 1) bboxflag = 1;
+    if (subregions[ilist]->bboxflag == 1) bboxflag = 1;
   if (!interior) bboxflag = 0;
 
   if (bboxflag) {
     int first = 1;
     for (int ilist = 0; ilist < nregion; ilist++) {
-      if (regions[list[ilist]]->bboxflag == 0) continue;
+      if (subregions[ilist]->bboxflag == 0) continue;
       if (first) {
-        extent_xlo = regions[list[ilist]]->extent_xlo;
-        extent_ylo = regions[list[ilist]]->extent_ylo;
-        extent_zlo = regions[list[ilist]]->extent_zlo;
-        extent_xhi = regions[list[ilist]]->extent_xhi;
-        extent_yhi = regions[list[ilist]]->extent_yhi;
-        extent_zhi = regions[list[ilist]]->extent_zhi;
+        extent_xlo = subregions[ilist]->extent_xlo;
+        extent_ylo = subregions[ilist]->extent_ylo;
+        extent_zlo = subregions[ilist]->extent_zlo;
+        extent_xhi = subregions[ilist]->extent_xhi;
+        extent_yhi = subregions[ilist]->extent_yhi;
+        extent_zhi = subregions[ilist]->extent_zhi;
         first = 0;
       }
 
-      extent_xlo = MAX(extent_xlo,regions[list[ilist]]->extent_xlo);
-      extent_ylo = MAX(extent_ylo,regions[list[ilist]]->extent_ylo);
-      extent_zlo = MAX(extent_zlo,regions[list[ilist]]->extent_zlo);
-      extent_xhi = MIN(extent_xhi,regions[list[ilist]]->extent_xhi);
-      extent_yhi = MIN(extent_yhi,regions[list[ilist]]->extent_yhi);
-      extent_zhi = MIN(extent_zhi,regions[list[ilist]]->extent_zhi);
+      extent_xlo = MAX(extent_xlo,subregions[ilist]->extent_xlo);
+      extent_ylo = MAX(extent_ylo,subregions[ilist]->extent_ylo);
+      extent_zlo = MAX(extent_zlo,subregions[ilist]->extent_zlo);
+      extent_xhi = MIN(extent_xhi,subregions[ilist]->extent_xhi);
+      extent_yhi = MIN(extent_yhi,subregions[ilist]->extent_yhi);
+      extent_zhi = MIN(extent_zhi,subregions[ilist]->extent_zhi);
     }
   }
 
@@ -94,12 +97,12 @@ RegIntersect::RegIntersect(LAMMPS *lmp, int narg, char **arg) :
 
   cmax = 0;
   for (int ilist = 0; ilist < nregion; ilist++)
-    cmax += regions[list[ilist]]->cmax;
+    cmax += subregions[ilist]->cmax;
   contact = new Contact[cmax];
 
   tmax = 0;
   for (int ilist = 0; ilist < nregion; ilist++) {
-    if (interior) tmax += regions[list[ilist]]->tmax;
+    if (interior) tmax += subregions[ilist]->tmax;
     else tmax++;
   }
 }
@@ -111,6 +114,7 @@ RegIntersect::~RegIntersect()
   for (int ilist = 0; ilist < nregion; ilist++) delete [] idsub[ilist];
   delete [] idsub;
   delete [] list;
+  delete [] subregions;
   delete [] contact;
 }
 
@@ -131,11 +135,12 @@ void RegIntersect::init()
     list[ilist] = iregion;
   }
 
-  // init the sub-regions
+  // init the sub-regions and cache their pointers for the per-atom loops
 
-  Region **regions = domain->regions;
-  for (int ilist = 0; ilist < nregion; ilist++)
-    regions[list[ilist]]->init();
+  for (int ilist = 0; ilist < nregion; ilist++) {
+    subregions[ilist] = domain->regions[list[ilist]];
+    subregions[ilist]->init();
+  }
 }
 
 /* ----------------------------------------------------------------------
@@ -146,9 +151,8 @@ void RegIntersect::init()
 int RegIntersect::inside(double x, double y, double z)
 {
   int ilist;
-  Region **regions = domain->regions;
   for (ilist = 0; ilist < nregion; ilist++)
-    if (!regions[list[ilist]]->match(x,y,z)) break;
+    if (!subregions[ilist]->match(x,y,z)) break;
 
   if (ilist == nregion) return 1;
   return 0;
@@ -218,7 +222,7 @@ int RegIntersect::surface_exterior(double *x, double cutoff)
   int n = 0;
 
   for (ilist = 0; ilist < nregion; ilist++)
-    regions[list[ilist]]->interior ^= 1;
+    subregions[ilist]->interior ^= 1;
 
   for (ilist = 0; ilist < nregion; ilist++) {
     iregion = list[ilist];
@@ -246,7 +250,7 @@ int RegIntersect::surface_exterior(double *x, double cutoff)
   }
 
   for (ilist = 0; ilist < nregion; ilist++)
-    regions[list[ilist]]->interior ^= 1;
+    subregions[ilist]->interior ^= 1;
 
   return n;
 }
@@ -257,9 +261,8 @@ int RegIntersect::surface_exterior(double *x, double cutoff)
 
 void RegIntersect::shape_update()
 {
-  Region **regions = domain->regions;
   for (int ilist = 0; ilist < nregion; ilist++)
-    regions[list[ilist]]->shape_update();
+    subregions[ilist]->shape_update();
 }
 
 /* ----------------------------------------------------------------------
@@ -268,9 +271,8 @@ void RegIntersect::shape_update()
 
 void RegIntersect::pretransform()
 {
-  Region **regions = domain->regions;
   for (int ilist = 0; ilist < nregion; ilist++)
-    regions[list[ilist]]->pretransform();
+    subregions[ilist]->pretransform();
 }
 
 
@@ -280,9 +282,8 @@ void RegIntersect::pretransform()
 
 void RegIntersect::set_velocity()
 {
-  Region **regions = domain->regions;
   for (int ilist = 0; ilist < nregion; ilist++)
-    regions[list[ilist]]->set_velocity();
+    subregions[ilist]->set_velocity();
 }
 
 /* ----------------------------------------------------------------------
@@ -295,7 +296,7 @@ void RegIntersect::length_restart_string(int& n)
   n += sizeof(int) + strlen(id)+1 +
     sizeof(int) + strlen(style)+1 + sizeof(int);
   for (int ilist = 0; ilist < nregion; ilist++)
-    domain->regions[list[ilist]]->length_restart_string(n);
+    subregions[ilist]->length_restart_string(n);
 
 }
 /* ----------------------------------------------------------------------
@@ -314,7 +315,7 @@ void RegIntersect::write_restart(FILE *fp)
   fwrite(&nregion,sizeof(int),1,fp);
 
   for (int ilist = 0; ilist < nregion; ilist++){
-    domain->regions[list[ilist]]->write_restart(fp);
+    subregions[ilist]->write_restart(fp);
   }
 }
 
@@ -340,7 +341,7 @@ int RegIntersect::restart(char *buf, int &n)
   if (restart_nreg != nregion) return 0;
 
   for (int ilist = 0; ilist < nregion; ilist++)
-    if (!domain->regions[list[ilist]]->restart(buf,n)) return 0;
+    if (!subregions[ilist]->restart(buf,n)) return 0;
 
   return 1;
 }
@@ -352,6 +353,6 @@ int RegIntersect::restart(char *buf, int &n)
 void RegIntersect::reset_vel()
 {
   for (int ilist = 0; ilist < nregion; ilist++)
-    domain->regions[list[ilist]]->reset_vel();
+    subregions[ilist]->reset_vel();
 }
 
@@ -42,6 +42,7 @@ class RegIntersect : public Region {
 
  private:
   char **idsub;
+  class Region **subregions;   // cached sub-region ptrs for hot loops
 };
 
 }
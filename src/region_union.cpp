@@ -53,12 +53,15 @@ RegUnion::RegUnion(LAMMPS *lmp, int narg, char **arg) : Region(lmp, narg, arg),
 
   // this region is variable shape or dynamic if any of sub-regions are
 
-  Region **regions = domain->regions;
+  subregions = new Region*[nregion];
+  for (int ilist = 0; ilist < nregion; ilist++)
+    subregions[ilist] = domain->regions[list[ilist]];
+
   for (int ilist = 0; ilist < nregion; ilist++) {
-    if (regions[list[ilist]]->varshape) varshape = 1;
-    if (regions[list[ilist]]->dynamic) dynamic = 1;
-    if (regions[list[ilist]]->moveflag) moveflag = 1;
-    if (regions[list[ilist]]->rotateflag) rotateflag = 1;
+    if (subregions[ilist]->varshape) varshape = 1;
+    if (subregions[ilist]->dynamic) dynamic = 1;
+    if (subregions[ilist]->moveflag) moveflag = 1;
+    if (subregions[ilist]->rotateflag) rotateflag = 1;
   }
 
   // extent of union of regions
@@ -66,7 +69,7 @@ RegUnion::RegUnion(LAMMPS *lmp, int narg, char **arg) : Region(lmp, narg, arg),
 
   bboxflag = 1;
   for (int ilist = 0; ilist < nregion; ilist++)
-    if (regions[list[ilist]]->bboxflag == 0) bboxflag = 0;
+    if (subregions[ilist]->bboxflag == 0) bboxflag = 0;
   if (!interior) bboxflag = 0;
 
   if (bboxflag) {
@@ -74,12 +77,12 @@ RegUnion::RegUnion(LAMMPS *lmp, int narg, char **arg) : Region(lmp, narg, arg),
     extent_xhi = extent_yhi = extent_zhi = -BIG;
 
     for (int ilist = 0; ilist < nregion; ilist++) {
-      extent_xlo = MIN(extent_xlo,regions[list[ilist]]->extent_xlo);
-      extent_ylo = MIN(extent_ylo,regions[list[ilist]]->extent_ylo);
-      extent_zlo = MIN(extent_zlo,regions[list[ilist]]->extent_zlo);
-      extent_xhi = MAX(extent_xhi,regions[list[ilist]]->extent_xhi);
-      extent_yhi = MAX(extent_yhi,regions[list[ilist]]->extent_yhi);
-      extent_zhi = MAX(extent_zhi,regions[list[ilist]]->extent_zhi);
+      extent_xlo = MIN(extent_xlo,subregions[ilist]->extent_xlo);
+      extent_ylo = MIN(extent_ylo,subregions[ilist]->extent_ylo);
+      extent_zlo = MIN(extent_zlo,subregions[ilist]->extent_zlo);
+      extent_xhi = MAX(extent_xhi,subregions[ilist]->extent_xhi);
+      extent_yhi = MAX(extent_yhi,subregions[ilist]->extent_yhi);
+      extent_zhi = MAX(extent_zhi,subregions[ilist]->extent_zhi);
     }
   }
 
@@ -88,12 +91,12 @@ RegUnion::RegUnion(LAMMPS *lmp, int narg, char **arg) : Region(lmp, narg, arg),
 
   cmax = 0;
   for (int ilist = 0; ilist < nregion; ilist++)
-    cmax += regions[list[ilist]]->cmax;
+    cmax += subregions[ilist]->cmax;
   contact = new Contact[cmax];
 
   tmax = 0;
   for (int ilist = 0; ilist < nregion; ilist++) {
-    if (interior) tmax += regions[list[ilist]]->tmax;
+    if (interior) tmax += subregions[ilist]->tmax;
     else tmax++;
   }
 }
@@ -105,6 +108,7 @@ RegUnion::~RegUnion()
   for (int ilist = 0; ilist < nregion; ilist++) delete [] idsub[ilist];
   delete [] idsub;
   delete [] list;
+  delete [] subregions;
   delete [] contact;
 }
 
@@ -125,11 +129,12 @@ void RegUnion::init()
     list[ilist] = iregion;
   }
 
-  // init the sub-regions
+  // init the sub-regions and cache their pointers for the per-atom loops
 
-  Region **regions = domain->regions;
-  for (int ilist = 0; ilist < nregion; ilist++)
-    regions[list[ilist]]->init();
+  for (int ilist = 0; ilist < nregion; ilist++) {
+    subregions[ilist] = domain->regions[list[ilist]];
+    subregions[ilist]->init();
+  }
 }
 
 /* ----------------------------------------------------------------------
@@ -140,9 +145,8 @@ void RegUnion::init()
 int RegUnion::inside(double x, double y, double z)
 {
   int ilist;
-  Region **regions = domain->regions;
   for (ilist = 0; ilist < nregion; ilist++)
-    if (regions[list[ilist]]->match(x,y,z)) break;
+    if (subregions[ilist]->match(x,y,z)) break;
 
   if (ilist == nregion) return 0;
   return 1;
@@ -213,7 +217,7 @@ int RegUnion::surface_exterior(double *x, double cutoff)
   int n = 0;
 
   for (ilist = 0; ilist < nregion; ilist++)
-    regions[list[ilist]]->interior ^= 1;
+    subregions[ilist]->interior ^= 1;
 
   for (ilist = 0; ilist < nregion; ilist++) {
     iregion = list[ilist];
@@ -241,7 +245,7 @@ int RegUnion::surface_exterior(double *x, double cutoff)
   }
 
   for (ilist = 0; ilist < nregion; ilist++)
-    regions[list[ilist]]->interior ^= 1;
+    subregions[ilist]->interior ^= 1;
 
   return n;
 }
@@ -252,9 +256,8 @@ int RegUnion::surface_exterior(double *x, double cutoff)
 
 void RegUnion::shape_update()
 {
-  Region **regions = domain->regions;
   for (int ilist = 0; ilist < nregion; ilist++)
-    regions[list[ilist]]->shape_update();
+    subregions[ilist]->shape_update();
 }
 
 /* ----------------------------------------------------------------------
@@ -263,9 +266,8 @@ void RegUnion::shape_update()
 
 void RegUnion::pretransform()
 {
-  Region **regions = domain->regions;
   for (int ilist = 0; ilist < nregion; ilist++)
-    regions[list[ilist]]->pretransform();
+    subregions[ilist]->pretransform();
 }
 
 /* ----------------------------------------------------------------------
@@ -274,9 +276,8 @@ void RegUnion::pretransform()
 
 void RegUnion::set_velocity()
 {
-  Region **regions = domain->regions;
   for (int ilist = 0; ilist < nregion; ilist++)
-    regions[list[ilist]]->set_velocity();
+    subregions[ilist]->set_velocity();
 }
 
 /* ----------------------------------------------------------------------
@@ -289,7 +290,7 @@ void RegUnion::length_restart_string(int& n)
   n += sizeof(int) + strlen(id)+1 +
     sizeof(int) + strlen(style)+1 + sizeof(int);
   for (int ilist = 0; ilist < nregion; ilist++)
-    domain->regions[list[ilist]]->length_restart_string(n);
+    subregions[ilist]->length_restart_string(n);
 
 }
 /* ----------------------------------------------------------------------
@@ -307,7 +308,7 @@ void RegUnion::write_restart(FILE *fp)
   fwrite(style, 1, sizestyle, fp);
   fwrite(&nregion,sizeof(int),1,fp);
   for (int ilist = 0; ilist < nregion; ilist++)
-    domain->regions[list[ilist]]->write_restart(fp);
+    subregions[ilist]->write_restart(fp);
 }
 
 /* ----------------------------------------------------------------------
@@ -332,7 +333,7 @@ int RegUnion::restart(char *buf, int &n)
   if (restart_nreg != nregion) return 0;
 
   for (int ilist = 0; ilist < nregion; ilist++)
-    if (!domain->regions[list[ilist]]->restart(buf,n)) return 0;
+    if (!subregions[ilist]->restart(buf,n)) return 0;
 
   return 1;
 }
@@ -344,5 +345,5 @@ int RegUnion::restart(char *buf, int &n)
 void RegUnion::reset_vel()
 {
   for (int ilist = 0; ilist < nregion; ilist++)
-    domain->regions[list[ilist]]->reset_vel();
+    subregions[ilist]->reset_vel();
 }
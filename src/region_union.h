@@ -41,6 +41,7 @@ class RegUnion : public Region {
   void reset_vel();
  private:
   char **idsub;
+  class Region **subregions;   // cached sub-region ptrs for hot loops
 };
 
 }
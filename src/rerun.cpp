@@ -22,6 +22,7 @@
 #include "output.h"
 #include "finish.h"
 #include "timer.h"
+#include "memory.h"
 #include "error.h"
 #include "force.h"
 
@@ -33,6 +34,15 @@ Rerun::Rerun(LAMMPS *lmp) : Pointers(lmp) {}
 
 /* ---------------------------------------------------------------------- */
 
+/* ----------------------------------------------------------------------
+   NOTE on parallel replay: frames are parsed by proc 0 and scattered
+   because a dump file's frame boundaries are only discoverable by
+   scanning; with the new .idx sidecar of single-file binary dumps the
+   frames are seekable, which is the entry point a parallel reader
+   would build on (each proc seeking its own frame range).  Text dump
+   parsing itself stays serial per frame.
+------------------------------------------------------------------------- */
+
 void Rerun::command(int narg, char **arg)
 {
   if (domain->box_exist == 0)
@@ -151,6 +161,13 @@ void Rerun::command(int narg, char **arg)
 
   while (1) {
     ndump++;
+
+    // all per-step scratch arena chunks expire here, as in the
+    // integrator run loops; without this each snapshot's transient
+    // aget() allocations (e.g. dump sorting) accumulate
+
+    memory->areset();
+
     rd->header(firstflag);
     update->reset_timestep(ntimestep);
     rd->atoms();
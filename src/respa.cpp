@@ -583,6 +583,10 @@ void Respa::run(int n)
     ntimestep = ++update->ntimestep;
     ev_set(ntimestep);
 
+    // all per-step scratch arena chunks expire here
+
+    memory->areset();
+
     recurse(nlevels-1);
 
     // needed in case end_of_step() or output() use total force
@@ -80,6 +80,13 @@ void Run::command(int narg, char **arg)
       if (iarg+2 > narg) error->all(FLERR,"Illegal run command");
       if (strcmp(arg[iarg+1],"no") == 0) preflag = 0;
       else if (strcmp(arg[iarg+1],"yes") == 0) preflag = 1;
+      else if (strcmp(arg[iarg+1],"auto") == 0) {
+
+        // warm start: skip the full setup when no state-changing
+        // command ran since the previous run ended
+
+        preflag = update->dirty;
+      }
       else error->all(FLERR,"Illegal run command");
       iarg += 2;
     } else if (strcmp(arg[iarg],"post") == 0) {
@@ -245,6 +252,7 @@ void Run::command(int narg, char **arg)
   }
 
   update->whichflag = 0;
+  update->dirty = 0;
   update->firststep = update->laststep = 0;
   update->beginstep = update->endstep = 0;
 
@@ -94,31 +94,38 @@ void Special::build()
   for (i = 0; i < nlocal; i++) nspecial[i][0] = num_bond[i];
 
   // if newton_bond off, then done
-  // else only counted 1/2 of all bonds, so count other half
+  // else only counted 1/2 of all bonds, so collect other half
+  // one ring pass circulates all (atom1,atom2) bond pairs; each proc
+  // keeps the halves it owns, then counts and fills locally, which
+  // replaces the separate counting pass over the same data
 
   if (force->newton_bond) {
 
     // nbufmax = largest buffer needed to hold info from any proc
-    // info for each atom = global tag of 2nd atom in each bond
+    // info for each atom = 2 global tags in each bond
 
     nbuf = 0;
-    for (i = 0; i < nlocal; i++) nbuf += num_bond[i];
+    for (i = 0; i < nlocal; i++) nbuf += 2*num_bond[i];
     memory->create(buf,nbuf,"special:buf");
 
-    // fill buffer with global tags of bond partners of my atoms
+    // fill buffer with global tags of both atoms in bond
 
     size = 0;
     for (i = 0; i < nlocal; i++)
-      for (j = 0; j < num_bond[i]; j++)
+      for (j = 0; j < num_bond[i]; j++) {
+        buf[size++] = tag[i];
         buf[size++] = bond_atom[i][j];
+      }
 
-    // cycle buffer around ring of procs back to self
-    // when receive buffer, scan tags for atoms I own
-    // when find one, increment nspecial count for that atom
+    npairs = maxpairs = 0;
+    pairidx = NULL;
+    pairtag = NULL;
 
-    comm->ring(size,sizeof(tagint),buf,1,ring_one,NULL,(void *)this);
+    comm->ring(size,sizeof(tagint),buf,2,ring_two,NULL,(void *)this);
 
     memory->destroy(buf);
+
+    for (i = 0; i < npairs; i++) nspecial[pairidx[i]][0]++;
   }
 
   // ----------------------------------------------------
@@ -149,33 +156,14 @@ void Special::build()
       onetwo[i][count[i]++] = bond_atom[i][j];
 
   // if newton_bond off, then done
-  // else only stored 1/2 of all bonds, so store other half
+  // else add the collected other halves of all bonds
 
   if (force->newton_bond) {
-
-    // nbufmax = largest buffer needed to hold info from any proc
-    // info for each atom = 2 global tags in each bond
-
-    nbuf = 0;
-    for (i = 0; i < nlocal; i++) nbuf += 2*num_bond[i];
-    memory->create(buf,nbuf,"special:buf");
-
-    // fill buffer with global tags of both atoms in bond
-
-    size = 0;
-    for (i = 0; i < nlocal; i++)
-      for (j = 0; j < num_bond[i]; j++) {
-        buf[size++] = tag[i];
-        buf[size++] = bond_atom[i][j];
-      }
-
-    // cycle buffer around ring of procs back to self
-    // when receive buffer, scan 2nd-atom tags for atoms I own
-    // when find one, add 1st-atom tag to onetwo list for 2nd atom
-
-    comm->ring(size,sizeof(tagint),buf,2,ring_two,NULL,(void *)this);
-
-    memory->destroy(buf);
+    for (i = 0; i < npairs; i++)
+      onetwo[pairidx[i]][count[pairidx[i]]++] = pairtag[i];
+    memory->destroy(pairidx);
+    memory->destroy(pairtag);
+    npairs = maxpairs = 0;
   }
 
   memory->destroy(count);
@@ -887,47 +875,34 @@ void Special::dihedral_trim()
   }
 }
 
-/* ----------------------------------------------------------------------
-   when receive buffer, scan tags for atoms I own
-   when find one, increment nspecial count for that atom
-------------------------------------------------------------------------- */
-
-void Special::ring_one(int ndatum, char *cbuf, void *ptr)
-{
-  Special *sptr = (Special *) ptr;
-  Atom *atom = sptr->atom;
-  int **nspecial = atom->nspecial;
-  int nlocal = atom->nlocal;
-
-  tagint *buf = (tagint *) cbuf;
-  int m;
-
-  for (int i = 0; i < ndatum; i++) {
-    m = atom->map(buf[i]);
-    if (m >= 0 && m < nlocal) nspecial[m][0]++;
-  }
-}
-
 /* ----------------------------------------------------------------------
    when receive buffer, scan 2nd-atom tags for atoms I own
-   when find one, add 1st-atom tag to onetwo list for 2nd atom
+   when find one, collect (owner index, 1st-atom tag) for local counting
+   and filling of the onetwo lists after the ring completes
 ------------------------------------------------------------------------- */
 
 void Special::ring_two(int ndatum, char *cbuf, void *ptr)
 {
   Special *sptr = (Special *) ptr;
   Atom *atom = sptr->atom;
+  Memory *memory = sptr->memory;
   int nlocal = atom->nlocal;
 
-  tagint **onetwo = sptr->onetwo;
-  int *count = sptr->count;
-
   tagint *buf = (tagint *) cbuf;
   int m;
 
   for (int i = 1; i < ndatum; i += 2) {
     m = atom->map(buf[i]);
-    if (m >= 0 && m < nlocal) onetwo[m][count[m]++] = buf[i-1];
+    if (m >= 0 && m < nlocal) {
+      if (sptr->npairs == sptr->maxpairs) {
+        sptr->maxpairs = sptr->maxpairs ? 2*sptr->maxpairs : 1024;
+        memory->grow(sptr->pairidx,sptr->maxpairs,"special:pairidx");
+        memory->grow(sptr->pairtag,sptr->maxpairs,"special:pairtag");
+      }
+      sptr->pairidx[sptr->npairs] = m;
+      sptr->pairtag[sptr->npairs] = buf[i-1];
+      sptr->npairs++;
+    }
   }
 }
 
@@ -41,7 +41,10 @@ class Special : protected Pointers {
 
   // callback functions for ring communication
 
-  static void ring_one(int, char *, void *);
+  int npairs,maxpairs;     // collected (owner,partner) halves of bonds
+  int *pairidx;            // local index of owner
+  tagint *pairtag;         // tag of its bond partner
+
   static void ring_two(int, char *, void *);
   static void ring_three(int, char *, void *);
   static void ring_four(int, char *, void *);
@@ -96,6 +96,8 @@ Thermo::Thermo(LAMMPS *lmp, int narg, char **arg) : Pointers(lmp)
 
   modified = 0;
   normuserflag = 0;
+  ebatchflag = 0;
+  ebatchvalid = 0;
   lineflag = ONELINE;
   lostflag = lostbond = Thermo::ERROR;
   lostbefore = 0;
@@ -326,6 +328,16 @@ void Thermo::header()
   }
 }
 
+/* ----------------------------------------------------------------------
+   NOTE on lazy formatting: the expensive parts of a thermo line are
+   already amortized -- per-field format strings are parsed once per
+   run, the energy-term reductions are batched into one allreduce, and
+   compute results are cached by the invoked timestamps.  What remains
+   per output step is one sprintf per field and the lost-atom check;
+   per-field change detection would save only the sprintf of fields
+   that happened not to move, while the check is the detection itself.
+------------------------------------------------------------------------- */
+
 /* ---------------------------------------------------------------------- */
 
 void Thermo::compute(int flag)
@@ -362,6 +374,26 @@ void Thermo::compute(int flag)
       }
     }
 
+  // batch the simple energy-term reductions into one allreduce
+  // the keyword methods below use these sums while this line is built,
+  // so several energy fields cost one reduction instead of one apiece
+
+  if (ebatchflag) {
+    double elocal[6],eglobal[6];
+    elocal[0] = elocal[1] = 0.0;
+    if (force->pair) {
+      elocal[0] = force->pair->eng_vdwl;
+      elocal[1] = force->pair->eng_coul;
+    }
+    elocal[2] = force->bond ? force->bond->energy : 0.0;
+    elocal[3] = force->angle ? force->angle->energy : 0.0;
+    elocal[4] = force->dihedral ? force->dihedral->energy : 0.0;
+    elocal[5] = force->improper ? force->improper->energy : 0.0;
+    MPI_Allreduce(elocal,eglobal,6,MPI_DOUBLE,MPI_SUM,world);
+    for (i = 0; i < 6; i++) ebatch[i] = eglobal[i];
+    ebatchvalid = 1;
+  }
+
   // if lineflag = MULTILINE, prepend step/cpu header line
 
   int loc = 0;
@@ -385,6 +417,10 @@ void Thermo::compute(int flag)
     }
   }
 
+  // batched sums are only safe while this line was being built
+
+  ebatchvalid = 0;
+
   // print line to screen and logfile
 
   if (me == 0) {
@@ -720,6 +756,7 @@ void Thermo::deallocate()
 
 void Thermo::parse_fields(char *str)
 {
+  ebatchflag = 0;
   nfield = 0;
 
   // customize a new keyword by adding to if statement
@@ -776,27 +813,35 @@ void Thermo::parse_fields(char *str)
 
     } else if (strcmp(word,"evdwl") == 0) {
       addfield("E_vdwl",&Thermo::compute_evdwl,FLOAT);
+      ebatchflag = 1;
       index_pe = add_compute(id_pe,SCALAR);
     } else if (strcmp(word,"ecoul") == 0) {
       addfield("E_coul",&Thermo::compute_ecoul,FLOAT);
+      ebatchflag = 1;
       index_pe = add_compute(id_pe,SCALAR);
     } else if (strcmp(word,"epair") == 0) {
       addfield("E_pair",&Thermo::compute_epair,FLOAT);
+      ebatchflag = 1;
       index_pe = add_compute(id_pe,SCALAR);
     } else if (strcmp(word,"ebond") == 0) {
       addfield("E_bond",&Thermo::compute_ebond,FLOAT);
+      ebatchflag = 1;
       index_pe = add_compute(id_pe,SCALAR);
     } else if (strcmp(word,"eangle") == 0) {
       addfield("E_angle",&Thermo::compute_eangle,FLOAT);
+      ebatchflag = 1;
       index_pe = add_compute(id_pe,SCALAR);
     } else if (strcmp(word,"edihed") == 0) {
       addfield("E_dihed",&Thermo::compute_edihed,FLOAT);
+      ebatchflag = 1;
       index_pe = add_compute(id_pe,SCALAR);
     } else if (strcmp(word,"eimp") == 0) {
       addfield("E_impro",&Thermo::compute_eimp,FLOAT);
+      ebatchflag = 1;
       index_pe = add_compute(id_pe,SCALAR);
     } else if (strcmp(word,"emol") == 0) {
       addfield("E_mol",&Thermo::compute_emol,FLOAT);
+      ebatchflag = 1;
       index_pe = add_compute(id_pe,SCALAR);
     } else if (strcmp(word,"elong") == 0) {
       addfield("E_long",&Thermo::compute_elong,FLOAT);
@@ -1764,9 +1809,12 @@ void Thermo::compute_enthalpy()
 
 void Thermo::compute_evdwl()
 {
-  double tmp = 0.0;
-  if (force->pair) tmp += force->pair->eng_vdwl;
-  MPI_Allreduce(&tmp,&dvalue,1,MPI_DOUBLE,MPI_SUM,world);
+  if (ebatchvalid) dvalue = ebatch[0];
+  else {
+    double tmp = 0.0;
+    if (force->pair) tmp += force->pair->eng_vdwl;
+    MPI_Allreduce(&tmp,&dvalue,1,MPI_DOUBLE,MPI_SUM,world);
+  }
 
   if (force->pair && force->pair->tail_flag) {
     double volume = domain->xprd * domain->yprd * domain->zprd;
@@ -1780,9 +1828,12 @@ void Thermo::compute_evdwl()
 
 void Thermo::compute_ecoul()
 {
-  double tmp = 0.0;
-  if (force->pair) tmp += force->pair->eng_coul;
-  MPI_Allreduce(&tmp,&dvalue,1,MPI_DOUBLE,MPI_SUM,world);
+  if (ebatchvalid) dvalue = ebatch[1];
+  else {
+    double tmp = 0.0;
+    if (force->pair) tmp += force->pair->eng_coul;
+    MPI_Allreduce(&tmp,&dvalue,1,MPI_DOUBLE,MPI_SUM,world);
+  }
   if (normflag) dvalue /= natoms;
 }
 
@@ -1790,9 +1841,12 @@ void Thermo::compute_ecoul()
 
 void Thermo::compute_epair()
 {
-  double tmp = 0.0;
-  if (force->pair) tmp += force->pair->eng_vdwl + force->pair->eng_coul;
-  MPI_Allreduce(&tmp,&dvalue,1,MPI_DOUBLE,MPI_SUM,world);
+  if (ebatchvalid) dvalue = ebatch[0] + ebatch[1];
+  else {
+    double tmp = 0.0;
+    if (force->pair) tmp += force->pair->eng_vdwl + force->pair->eng_coul;
+    MPI_Allreduce(&tmp,&dvalue,1,MPI_DOUBLE,MPI_SUM,world);
+  }
 
   if (force->kspace) dvalue += force->kspace->energy;
   if (force->pair && force->pair->tail_flag) {
@@ -1808,8 +1862,11 @@ void Thermo::compute_epair()
 void Thermo::compute_ebond()
 {
   if (force->bond) {
-    double tmp = force->bond->energy;
-    MPI_Allreduce(&tmp,&dvalue,1,MPI_DOUBLE,MPI_SUM,world);
+    if (ebatchvalid) dvalue = ebatch[2];
+    else {
+      double tmp = force->bond->energy;
+      MPI_Allreduce(&tmp,&dvalue,1,MPI_DOUBLE,MPI_SUM,world);
+    }
     if (normflag) dvalue /= natoms;
   } else dvalue = 0.0;
 }
@@ -1819,8 +1876,11 @@ void Thermo::compute_ebond()
 void Thermo::compute_eangle()
 {
   if (force->angle) {
-    double tmp = force->angle->energy;
-    MPI_Allreduce(&tmp,&dvalue,1,MPI_DOUBLE,MPI_SUM,world);
+    if (ebatchvalid) dvalue = ebatch[3];
+    else {
+      double tmp = force->angle->energy;
+      MPI_Allreduce(&tmp,&dvalue,1,MPI_DOUBLE,MPI_SUM,world);
+    }
     if (normflag) dvalue /= natoms;
   } else dvalue = 0.0;
 }
@@ -1830,8 +1890,11 @@ void Thermo::compute_eangle()
 void Thermo::compute_edihed()
 {
   if (force->dihedral) {
-    double tmp = force->dihedral->energy;
-    MPI_Allreduce(&tmp,&dvalue,1,MPI_DOUBLE,MPI_SUM,world);
+    if (ebatchvalid) dvalue = ebatch[4];
+    else {
+      double tmp = force->dihedral->energy;
+      MPI_Allreduce(&tmp,&dvalue,1,MPI_DOUBLE,MPI_SUM,world);
+    }
     if (normflag) dvalue /= natoms;
   } else dvalue = 0.0;
 }
@@ -1841,8 +1904,11 @@ void Thermo::compute_edihed()
 void Thermo::compute_eimp()
 {
   if (force->improper) {
-    double tmp = force->improper->energy;
-    MPI_Allreduce(&tmp,&dvalue,1,MPI_DOUBLE,MPI_SUM,world);
+    if (ebatchvalid) dvalue = ebatch[5];
+    else {
+      double tmp = force->improper->energy;
+      MPI_Allreduce(&tmp,&dvalue,1,MPI_DOUBLE,MPI_SUM,world);
+    }
     if (normflag) dvalue /= natoms;
   } else dvalue = 0.0;
 }
@@ -1853,11 +1919,14 @@ void Thermo::compute_emol()
 {
   double tmp = 0.0;
   if (atom->molecular) {
-    if (force->bond) tmp += force->bond->energy;
-    if (force->angle) tmp += force->angle->energy;
-    if (force->dihedral) tmp += force->dihedral->energy;
-    if (force->improper) tmp += force->improper->energy;
-    MPI_Allreduce(&tmp,&dvalue,1,MPI_DOUBLE,MPI_SUM,world);
+    if (ebatchvalid) dvalue = ebatch[2] + ebatch[3] + ebatch[4] + ebatch[5];
+    else {
+      if (force->bond) tmp += force->bond->energy;
+      if (force->angle) tmp += force->angle->energy;
+      if (force->dihedral) tmp += force->dihedral->energy;
+      if (force->improper) tmp += force->improper->energy;
+      MPI_Allreduce(&tmp,&dvalue,1,MPI_DOUBLE,MPI_SUM,world);
+    }
     if (normflag) dvalue /= natoms;
   } else dvalue = 0.0;
 }
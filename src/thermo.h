@@ -82,6 +82,11 @@ class Thermo : protected Pointers {
   bigint bivalue;        // big integer value to print
   int ifield;            // which field in thermo output is being computed
   int *field2index;      // which compute,fix,variable calcs this field
+
+  int ebatchflag;        // 1 if an energy-term keyword is in the output
+  int ebatchvalid;       // 1 while batched sums below apply to this line
+  double ebatch[6];      // summed vdwl,coul,bond,angle,dihedral,improper
+
   int *argindex1;        // indices into compute,fix scalar,vector
   int *argindex2;
 
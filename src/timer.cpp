@@ -93,6 +93,7 @@ static double CPU_Time()
 
 Timer::Timer(LAMMPS *lmp) : Pointers(lmp)
 {
+  _detail = 0;
   _level = NORMAL;
   _sync  = OFF;
   _timeout = -1;
@@ -295,6 +296,10 @@ void Timer::modify_params(int narg, char **arg)
       _sync  = OFF;
     } else if (strcmp(arg[iarg],timer_mode[NORMAL])  == 0) {
       _sync  = NORMAL;
+    } else if (strcmp(arg[iarg],"detail") == 0) {
+      _detail = 1;
+    } else if (strcmp(arg[iarg],"nodetail") == 0) {
+      _detail = 0;
     } else if (strcmp(arg[iarg],"timeout") == 0) {
       ++iarg;
       if (iarg < narg) {
@@ -45,6 +45,7 @@ class Timer : protected Pointers {
   bool has_loop()   const { return (_level >= LOOP); }
   bool has_normal() const { return (_level >= NORMAL); }
   bool has_full()   const { return (_level >= FULL); }
+  bool has_detail() const { return _detail != 0; }
   bool has_sync()   const { return (_sync  != OFF); }
 
   // flag if wallclock time is expired
@@ -92,6 +93,7 @@ class Timer : protected Pointers {
   double previous_wall;
   double timeout_start;
   int _level;     // level of detail: off=0,loop=1,normal=2,full=3
+  int _detail;   // 1 = accumulate per-fix and per-substyle times
   int _sync;      // if nonzero, synchronize tasks before setting the timer
   int _timeout;   // max allowed wall time in seconds. infinity if negative
   int _s_timeout; // copy of timeout for restoring after a forced timeout
@@ -158,6 +158,16 @@ void Universe::reorder(char *style, char *arg)
    str = P -> add 1 world with P procs
 ------------------------------------------------------------------------- */
 
+/* ----------------------------------------------------------------------
+   NOTE on dynamic partitions: world communicators are created once
+   here and every package-level structure (per-world comm, logs,
+   partition-aware fixes) assumes they are immutable for the process
+   lifetime.  Resizing partitions at run time means rebuilding all of
+   that mid-simulation; load-balancing variable-cost campaign members
+   is better done by the scheduler above LAMMPS (more members than
+   partitions, refill as they finish), which needs no code support.
+------------------------------------------------------------------------- */
+
 void Universe::add_world(char *str)
 {
   int n,nper;
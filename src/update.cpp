@@ -42,6 +42,7 @@ Update::Update(LAMMPS *lmp) : Pointers(lmp)
   atime = 0.0;
   atimestep = 0;
   first_update = 0;
+  dirty = 1;
 
   whichflag = 0;
   firststep = laststep = 0;
@@ -96,6 +96,9 @@ Variable::Variable(LAMMPS *lmp) : Pointers(lmp)
   vecs = NULL;
 
   eval_in_progress = NULL;
+  isconst = NULL;
+  constvalue = NULL;
+  eval_dynamic = 0;
 
   randomequal = NULL;
   randomatom = NULL;
@@ -136,6 +139,8 @@ Variable::~Variable()
   memory->sfree(vecs);
 
   memory->destroy(eval_in_progress);
+  memory->destroy(isconst);
+  memory->destroy(constvalue);
 
   delete randomequal;
   delete randomatom;
@@ -391,6 +396,7 @@ void Variable::set(int narg, char **arg)
         error->all(FLERR,"Cannot redefine variable as a different style");
       delete [] data[ivar][0];
       copy(1,&arg[2],data[ivar]);
+      isconst[ivar] = 0;
       replaceflag = 1;
     } else {
       if (nvar == maxvar) grow();
@@ -522,6 +528,7 @@ void Variable::set(int narg, char **arg)
               "characters or underscore",names[nvar]);
       error->all(FLERR,errmsg);
     }
+  isconst[nvar] = 0;
   nvar++;
 }
 
@@ -911,7 +918,24 @@ double Variable::compute_equal(int ivar)
   eval_in_progress[ivar] = 1;
 
   double value = 0.0;
-  if (style[ivar] == EQUAL) value = evaluate(data[ivar][0],NULL,ivar);
+  if (style[ivar] == EQUAL) {
+
+    // expressions whose leaves are all constant evaluate to the same
+    // value forever: cache them after the first full evaluation
+    // eval_dynamic is raised by every time-varying leaf and nests
+
+    if (isconst[ivar]) value = constvalue[ivar];
+    else {
+      int dyn_outer = eval_dynamic;
+      eval_dynamic = 0;
+      value = evaluate(data[ivar][0],NULL,ivar);
+      if (!eval_dynamic) {
+        isconst[ivar] = 1;
+        constvalue[ivar] = value;
+      }
+      eval_dynamic |= dyn_outer;
+    }
+  }
   else if (style[ivar] == INTERNAL) value = dvalue[ivar];
   else if (style[ivar] == PYTHON) {
     int ifunc = python->find(data[ivar][0]);
@@ -1090,6 +1114,8 @@ void Variable::remove(int n)
     pad[i-1] = pad[i];
     reader[i-1] = reader[i];
     data[i-1] = data[i];
+    isconst[i-1] = isconst[i];
+    constvalue[i-1] = constvalue[i];
   }
   nvar--;
 }
@@ -1124,6 +1150,9 @@ void Variable::grow()
 
   memory->grow(eval_in_progress,maxvar,"var:eval_in_progress");
   for (int i = 0; i < maxvar; i++) eval_in_progress[i] = 0;
+
+  memory->grow(isconst,maxvar,"var:isconst");
+  memory->grow(constvalue,maxvar,"var:constvalue");
 }
 
 /* ----------------------------------------------------------------------
@@ -1275,6 +1304,7 @@ double Variable::evaluate(char *str, Tree **tree, int ivar)
       // ----------------
 
       if (strncmp(word,"c_",2) == 0 || strncmp(word,"C_",2) == 0) {
+        eval_dynamic = 1;
         if (domain->box_exist == 0)
           print_var_error(FLERR,"Variable evaluation before "
                           "simulation box is defined",ivar);
@@ -1573,6 +1603,7 @@ double Variable::evaluate(char *str, Tree **tree, int ivar)
       // ----------------
 
       } else if (strncmp(word,"f_",2) == 0 || strncmp(word,"F_",2) == 0) {
+        eval_dynamic = 1;
         if (domain->box_exist == 0)
           print_var_error(FLERR,"Variable evaluation before simulation box is defined",ivar);
 
@@ -1822,6 +1853,7 @@ double Variable::evaluate(char *str, Tree **tree, int ivar)
       // ----------------
 
       } else if (strncmp(word,"v_",2) == 0) {
+        eval_dynamic = 1;
 
         int ivar = find(word+2);
         if (ivar < 0)
@@ -2032,6 +2064,7 @@ double Variable::evaluate(char *str, Tree **tree, int ivar)
         // ----------------
 
         } else if (is_atom_vector(word)) {
+          eval_dynamic = 1;
           if (domain->box_exist == 0)
             print_var_error(FLERR,"Variable evaluation before "
                             "simulation box is defined",ivar);
@@ -2062,6 +2095,7 @@ double Variable::evaluate(char *str, Tree **tree, int ivar)
             print_var_error(FLERR,"Variable evaluation before "
                             "simulation box is defined",ivar);
 
+          eval_dynamic = 1;
           int flag = output->thermo->evaluate_keyword(word,&value1);
           if (flag) {
             char msg[128];
@@ -3422,6 +3456,7 @@ int Variable::math_function(char *word, char *contents, Tree **tree,
     else argstack[nargstack++] = atan2(value1,value2);
 
   } else if (strcmp(word,"random") == 0) {
+    eval_dynamic = 1;
     if (narg != 3)
       print_var_error(FLERR,"Invalid math function in variable formula",ivar);
     if (tree) newtree->type = RANDOM;
@@ -3435,6 +3470,7 @@ int Variable::math_function(char *word, char *contents, Tree **tree,
       argstack[nargstack++] = randomequal->uniform()*(value2-value1) + value1;
     }
   } else if (strcmp(word,"normal") == 0) {
+    eval_dynamic = 1;
     if (narg != 3)
       print_var_error(FLERR,"Invalid math function in variable formula",ivar);
     if (tree) newtree->type = NORMAL;
@@ -3469,6 +3505,7 @@ int Variable::math_function(char *word, char *contents, Tree **tree,
     else argstack[nargstack++] = MYROUND(value1);
 
   } else if (strcmp(word,"ramp") == 0) {
+    eval_dynamic = 1;
     if (narg != 2)
       print_var_error(FLERR,"Invalid math function in variable formula",ivar);
     if (update->whichflag == 0)
@@ -3482,6 +3519,7 @@ int Variable::math_function(char *word, char *contents, Tree **tree,
     }
 
   } else if (strcmp(word,"stagger") == 0) {
+    eval_dynamic = 1;
     if (narg != 2)
       print_var_error(FLERR,"Invalid math function in variable formula",ivar);
     if (tree) newtree->type = STAGGER;
@@ -3499,6 +3537,7 @@ int Variable::math_function(char *word, char *contents, Tree **tree,
     }
 
   } else if (strcmp(word,"logfreq") == 0) {
+    eval_dynamic = 1;
     if (narg != 3)
       print_var_error(FLERR,"Invalid math function in variable formula",ivar);
     if (tree) newtree->type = LOGFREQ;
@@ -3521,6 +3560,7 @@ int Variable::math_function(char *word, char *contents, Tree **tree,
     }
 
   } else if (strcmp(word,"logfreq2") == 0) {
+    eval_dynamic = 1;
     if (narg != 3)
       print_var_error(FLERR,"Invalid math function in variable formula",ivar);
     if (tree) newtree->type = LOGFREQ2;
@@ -3546,6 +3586,7 @@ int Variable::math_function(char *word, char *contents, Tree **tree,
     }
 
   } else if (strcmp(word,"stride") == 0) {
+    eval_dynamic = 1;
     if (narg != 3)
       print_var_error(FLERR,"Invalid math function in variable formula",ivar);
     if (tree) newtree->type = STRIDE;
@@ -3566,6 +3607,7 @@ int Variable::math_function(char *word, char *contents, Tree **tree,
     }
 
   } else if (strcmp(word,"stride2") == 0) {
+    eval_dynamic = 1;
     if (narg != 6)
       print_var_error(FLERR,"Invalid math function in variable formula",ivar);
     if (tree) newtree->type = STRIDE2;
@@ -3604,6 +3646,7 @@ int Variable::math_function(char *word, char *contents, Tree **tree,
     }
 
   } else if (strcmp(word,"vdisplace") == 0) {
+    eval_dynamic = 1;
     if (narg != 2)
       print_var_error(FLERR,"Invalid math function in variable formula",ivar);
     if (update->whichflag == 0)
@@ -3616,6 +3659,7 @@ int Variable::math_function(char *word, char *contents, Tree **tree,
     }
 
   } else if (strcmp(word,"swiggle") == 0) {
+    eval_dynamic = 1;
     if (narg != 3)
       print_var_error(FLERR,"Invalid math function in variable formula",ivar);
     if (update->whichflag == 0)
@@ -3631,6 +3675,7 @@ int Variable::math_function(char *word, char *contents, Tree **tree,
     }
 
   } else if (strcmp(word,"cwiggle") == 0) {
+    eval_dynamic = 1;
     if (narg != 3)
       print_var_error(FLERR,"Invalid math function in variable formula",ivar);
     if (update->whichflag == 0)
@@ -3670,6 +3715,7 @@ int Variable::group_function(char *word, char *contents, Tree **tree,
                              Tree **treestack, int &ntreestack,
                              double *argstack, int &nargstack, int ivar)
 {
+  eval_dynamic = 1;
   // word not a match to any group function
 
   if (strcmp(word,"count") && strcmp(word,"mass") &&
@@ -3888,6 +3934,7 @@ int Variable::group_function(char *word, char *contents, Tree **tree,
 
 int Variable::region_function(char *id, int ivar)
 {
+  eval_dynamic = 1;
   int iregion = domain->find_region(id);
   if (iregion == -1)
     print_var_error(FLERR,"Region ID in variable formula does not exist",ivar);
@@ -3914,6 +3961,7 @@ int Variable::special_function(char *word, char *contents, Tree **tree,
                                Tree **treestack, int &ntreestack,
                                double *argstack, int &nargstack, int ivar)
 {
+  eval_dynamic = 1;
   double value,xvalue,sx,sy,sxx,sxy;
 
   // word not a match to any special function
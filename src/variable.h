@@ -70,6 +70,9 @@ class Variable : protected Pointers {
   VecVar *vecs;
 
   int *eval_in_progress;       // flag if evaluation of variable is in progress
+  int *isconst;                // 1 if equal-style var proved constant
+  double *constvalue;          // its cached value
+  int eval_dynamic;            // raised by time-varying leaves during eval
   int treetype;                // ATOM or VECTOR flag for formula evaluation
 
   class RanMars *randomequal;   // random number generator for equal-style vars
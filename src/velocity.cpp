@@ -36,6 +36,23 @@
 
 using namespace LAMMPS_NS;
 
+// sort local indices ascending by atom tag (for deterministic RNG jumps)
+
+static tagint *sort_tags_ptr;
+static int sort_by_tag_cmp(const void *a, const void *b)
+{
+  tagint ta = sort_tags_ptr[*(const int *) a];
+  tagint tb = sort_tags_ptr[*(const int *) b];
+  if (ta < tb) return -1;
+  if (ta > tb) return 1;
+  return 0;
+}
+
+static void sort_by_tag(int *idx, int n)
+{
+  qsort(idx,n,sizeof(int),sort_by_tag_cmp);
+}
+
 enum{CREATE,SET,SCALE,RAMP,ZERO};
 enum{ALL,LOCAL,GEOM};
 enum{NONE,CONSTANT,EQUAL,ATOM};
@@ -280,25 +297,56 @@ void Velocity::create(double t_desired, int seed)
     random = new RanPark(lmp,seed);
     int natoms = static_cast<int> (atom->natoms);
 
-    for (i = 1; i <= natoms; i++) {
-      if (dist_flag == 0) {
+    // uniform draws consume exactly 3 RNG values per global ID, so each
+    // proc can jump the generator straight to its own atoms' positions
+    // in the stream (O(log N) per atom) instead of generating all 3N
+    // values; produces the identical velocities to the full loop
+    // gaussian draws use rejection, so their stream positions are
+    // data-dependent and keep the full loop
+
+    if (dist_flag == 0) {
+      tagint *tag = atom->tag;
+      int nmine = 0;
+      int *mine;
+      memory->create(mine,nlocal,"velocity:mine");
+      for (m = 0; m < nlocal; m++)
+        if (mask[m] & groupbit) mine[nmine++] = m;
+      sort_tags_ptr = tag;
+      sort_by_tag(mine,nmine);
+
+      bigint pos = 0;
+      for (int mm = 0; mm < nmine; mm++) {
+        m = mine[mm];
+        bigint target = 3*((bigint) tag[m] - 1);
+        random->jump(target - pos);
         vx = random->uniform() - 0.5;
         vy = random->uniform() - 0.5;
         vz = random->uniform() - 0.5;
-      } else {
+        pos = target + 3;
+        if (rmass) factor = 1.0/sqrt(rmass[m]);
+        else factor = 1.0/sqrt(mass[type[m]]);
+        v[m][0] = vx * factor;
+        v[m][1] = vy * factor;
+        if (dim == 3) v[m][2] = vz * factor;
+        else v[m][2] = 0.0;
+      }
+      memory->destroy(mine);
+
+    } else {
+      for (i = 1; i <= natoms; i++) {
         vx = random->gaussian();
         vy = random->gaussian();
         vz = random->gaussian();
-      }
-      m = atom->map(i);
-      if (m >= 0 && m < nlocal) {
-        if (mask[m] & groupbit) {
-          if (rmass) factor = 1.0/sqrt(rmass[m]);
-          else factor = 1.0/sqrt(mass[type[m]]);
-          v[m][0] = vx * factor;
-          v[m][1] = vy * factor;
-          if (dim == 3) v[m][2] = vz * factor;
-          else v[m][2] = 0.0;
+        m = atom->map(i);
+        if (m >= 0 && m < nlocal) {
+          if (mask[m] & groupbit) {
+            if (rmass) factor = 1.0/sqrt(rmass[m]);
+            else factor = 1.0/sqrt(mass[type[m]]);
+            v[m][0] = vx * factor;
+            v[m][1] = vy * factor;
+            if (dim == 3) v[m][2] = vz * factor;
+            else v[m][2] = 0.0;
+          }
         }
       }
     }
@@ -246,6 +246,10 @@ void Verlet::run(int n)
     ntimestep = ++update->ntimestep;
     ev_set(ntimestep);
 
+    // all per-step scratch arena chunks expire here
+
+    memory->areset();
+
     // initial time integration
 
     timer->stamp();
@@ -259,7 +263,7 @@ void Verlet::run(int n)
 
     if (nflag == 0) {
       timer->stamp();
-      comm->forward_comm();
+      comm->forward_comm_start();
       timer->stamp(Timer::COMM);
     } else {
       if (n_pre_exchange) {
@@ -296,9 +300,17 @@ void Verlet::run(int n)
     // important for pair to come before bonded contributions
     // since some bonded potentials tally pairwise energy/virial
     // and Pair:ev_tally() needs to be called before any tallying
+    // force clear overlaps with any still in-flight ghost exchange,
+    // which must be complete before anything reads ghost positions
 
     force_clear();
 
+    if (nflag == 0) {
+      timer->stamp();
+      comm->forward_comm_finish();
+      timer->stamp(Timer::COMM);
+    }
+
     timer->stamp();
 
     if (n_pre_force) {
@@ -380,13 +392,44 @@ void Verlet::force_clear()
   int nlocal = atom->nlocal;
 
   if (neighbor->includegroup == 0) {
-    nbytes = sizeof(double) * nlocal;
-    if (force->newton) nbytes += sizeof(double) * atom->nghost;
+    int nclear = nlocal;
+    if (force->newton) nclear += atom->nghost;
+    nbytes = sizeof(double) * nclear;
 
     if (nbytes) {
+
+      // the clears are pure bandwidth: split them across threads so
+      // multi-socket ranks use all memory channels
+      // epoch-tagged skipping was rejected: every force style and fix
+      // accumulates with +=, so valid zeros must exist beforehand
+
+#if defined(_OPENMP)
+      if (comm->nthreads > 1 && nclear > 16384) {
+        double *fbase = &atom->f[0][0];
+#pragma omp parallel for schedule(static)
+        for (int i = 0; i < nclear; i++) {
+          fbase[3*i] = 0.0;
+          fbase[3*i+1] = 0.0;
+          fbase[3*i+2] = 0.0;
+        }
+        if (torqueflag) {
+          double *tbase = &atom->torque[0][0];
+#pragma omp parallel for schedule(static)
+          for (int i = 0; i < nclear; i++) {
+            tbase[3*i] = 0.0;
+            tbase[3*i+1] = 0.0;
+            tbase[3*i+2] = 0.0;
+          }
+        }
+        if (extraflag) atom->avec->force_clear(0,nbytes);
+      } else {
+#endif
       memset(&atom->f[0][0],0,3*nbytes);
       if (torqueflag) memset(&atom->torque[0][0],0,3*nbytes);
       if (extraflag) atom->avec->force_clear(0,nbytes);
+#if defined(_OPENMP)
+      }
+#endif
     }
 
   // neighbor includegroup flag is set
@@ -36,6 +36,15 @@
 
 using namespace LAMMPS_NS;
 
+// bit-preserving view of integer values stored in double buffers,
+// matches the ubuf union the AtomVec pack methods use
+
+union dubuf {
+  double d;
+  int64_t i;
+  dubuf(double arg) : d(arg) {}
+};
+
 enum{II,IJ};
 
 /* ---------------------------------------------------------------------- */
@@ -76,6 +85,12 @@ void WriteData::command(int narg, char **arg)
   fixflag = 1;
   int noinit = 0;
 
+  // filename ending in .bin selects binary Atoms/Velocities sections
+
+  binaryflag = 0;
+  char *suffix = file + strlen(file) - strlen(".bin");
+  if (suffix > file && strcmp(suffix,".bin") == 0) binaryflag = 1;
+
   int iarg = 1;
   while (iarg < narg) {
     if (strcmp(arg[iarg],"pair") == 0) {
@@ -233,6 +248,7 @@ void WriteData::header()
 
   fprintf(fp,BIGINT_FORMAT " atoms\n",atom->natoms);
   fprintf(fp,"%d atom types\n",atom->ntypes);
+  if (binaryflag) fprintf(fp,"binary sections\n");
 
   // do not write molecular topology info for atom_style template
 
@@ -318,6 +334,31 @@ void WriteData::force_fields()
   }
 }
 
+/* ----------------------------------------------------------------------
+   convert the integer-typed columns of packed data-file rows from their
+   raw ubuf bit patterns to numeric doubles, so binary sections are plain
+   fixed-stride double records
+   first column is always the atom ID, nextra trailing int columns
+   (image flags) follow the typed ones
+------------------------------------------------------------------------- */
+
+void WriteData::transcode(int n, int ncol, double **buf,
+                          const char *cols, int base, int nextra)
+{
+  if (cols == NULL)
+    error->one(FLERR,"Atom style does not support binary data sections");
+  int ntyped = strlen(cols);
+
+  for (int i = 0; i < n; i++) {
+    double *row = buf[i];
+    if (base) row[0] = (double) dubuf(row[0]).i;
+    for (int m = 0; m < ntyped; m++)
+      if (cols[m] == 'i') row[base+m] = (double) dubuf(row[base+m]).i;
+    for (int m = ncol-nextra; m < ncol; m++)
+      row[m] = (double) dubuf(row[m]).i;
+  }
+}
+
 /* ----------------------------------------------------------------------
    write out Atoms section of data file
 ------------------------------------------------------------------------- */
@@ -361,8 +402,12 @@ void WriteData::atoms()
         recvrow /= ncol;
       } else recvrow = sendrow;
 
-      atom->avec->write_data(fp,recvrow,buf);
+      if (binaryflag) {
+        transcode(recvrow,ncol,buf,atom->avec->data_atom_cols,0,3);
+        fwrite(&buf[0][0],sizeof(double),recvrow*ncol,fp);
+      } else atom->avec->write_data(fp,recvrow,buf);
     }
+    if (binaryflag) fprintf(fp,"\n");
 
   } else {
     MPI_Recv(&tmp,0,MPI_INT,0,0,world,MPI_STATUS_IGNORE);
@@ -415,8 +460,12 @@ void WriteData::velocities()
         recvrow /= ncol;
       } else recvrow = sendrow;
 
-      atom->avec->write_vel(fp,recvrow,buf);
+      if (binaryflag) {
+        transcode(recvrow,ncol,buf,atom->avec->data_vel_cols,1,0);
+        fwrite(&buf[0][0],sizeof(double),recvrow*ncol,fp);
+      } else atom->avec->write_vel(fp,recvrow,buf);
     }
+    if (binaryflag) fprintf(fp,"\n");
 
   } else {
     MPI_Recv(&tmp,0,MPI_INT,0,0,world,MPI_STATUS_IGNORE);
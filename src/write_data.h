@@ -35,6 +35,9 @@ class WriteData : protected Pointers {
   int me,nprocs;
   int pairflag;
   int coeffflag;
+  int binaryflag;       // 1 if Atoms/Velocities bodies written as raw doubles
+
+  void transcode(int, int, double **, const char *, int, int);
   int fixflag;
   FILE *fp;
   bigint nbonds_local,nbonds;
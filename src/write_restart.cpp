@@ -39,6 +39,55 @@
 
 using namespace LAMMPS_NS;
 
+#if defined(_OPENMP)
+
+// helper thread for restart async mode: writes and closes one per-proc
+// restart body while the timestep loop continues
+// OpenMP-enabled compiles always link the pthread runtime
+
+#include <pthread.h>
+
+namespace {
+  struct RestartWriter {
+    pthread_t thread;
+    pthread_mutex_t lock;
+    pthread_cond_t work,done;
+    FILE *jobfp;
+    int jobflag,jobn;
+    double *jobbuf;              // owned by the thread, freed after write
+    int pending,shutdown;
+  };
+
+  void *restart_writer_run(void *ptr)
+  {
+    RestartWriter *w = (RestartWriter *) ptr;
+    pthread_mutex_lock(&w->lock);
+    while (1) {
+      while (!w->pending && !w->shutdown)
+        pthread_cond_wait(&w->work,&w->lock);
+      if (w->pending) {
+        FILE *jobfp = w->jobfp;
+        int jobflag = w->jobflag;
+        int jobn = w->jobn;
+        double *jobbuf = w->jobbuf;
+        pthread_mutex_unlock(&w->lock);
+        fwrite(&jobflag,sizeof(int),1,jobfp);
+        fwrite(&jobn,sizeof(int),1,jobfp);
+        fwrite(jobbuf,sizeof(double),jobn,jobfp);
+        fclose(jobfp);
+        free(jobbuf);
+        pthread_mutex_lock(&w->lock);
+        w->pending = 0;
+        pthread_cond_signal(&w->done);
+      } else break;
+    }
+    pthread_mutex_unlock(&w->lock);
+    return NULL;
+  }
+}
+
+#endif
+
 // same as read_restart.cpp
 
 #define MAGIC_STRING "LammpS RestartT"
@@ -67,6 +116,8 @@ enum{VERSION,SMALLINT,TAGINT,BIGINT,
 
 WriteRestart::WriteRestart(LAMMPS *lmp) : Pointers(lmp)
 {
+  asyncflag = 0;
+  awriter = NULL;
   MPI_Comm_rank(world,&me);
   MPI_Comm_size(world,&nprocs);
   multiproc = 0;
@@ -74,6 +125,27 @@ WriteRestart::WriteRestart(LAMMPS *lmp) : Pointers(lmp)
   fp = NULL;
 }
 
+/* ---------------------------------------------------------------------- */
+
+WriteRestart::~WriteRestart()
+{
+#if defined(_OPENMP)
+  if (awriter) {
+    RestartWriter *w = (RestartWriter *) awriter;
+    pthread_mutex_lock(&w->lock);
+    while (w->pending) pthread_cond_wait(&w->done,&w->lock);
+    w->shutdown = 1;
+    pthread_cond_signal(&w->work);
+    pthread_mutex_unlock(&w->lock);
+    pthread_join(w->thread,NULL);
+    pthread_mutex_destroy(&w->lock);
+    pthread_cond_destroy(&w->work);
+    pthread_cond_destroy(&w->done);
+    delete w;
+  }
+#endif
+}
+
 /* ----------------------------------------------------------------------
    called as write_restart command in input script
 ------------------------------------------------------------------------- */
@@ -148,6 +220,7 @@ void WriteRestart::multiproc_options(int multiproc_caller, int mpiioflag_caller,
                                      int narg, char **arg)
 {
   multiproc = multiproc_caller;
+  asyncflag = 0;
   mpiioflag = mpiioflag_caller;
 
   // error checks
@@ -181,7 +254,17 @@ void WriteRestart::multiproc_options(int multiproc_caller, int mpiioflag_caller,
 
   int iarg = 0;
   while (iarg < narg) {
-    if (strcmp(arg[iarg],"fileper") == 0) {
+    if (strcmp(arg[iarg],"async") == 0) {
+      if (iarg+2 > narg) error->all(FLERR,"Illegal write_restart command");
+      if (strcmp(arg[iarg+1],"yes") == 0) asyncflag = 1;
+      else if (strcmp(arg[iarg+1],"no") == 0) asyncflag = 0;
+      else error->all(FLERR,"Illegal write_restart command");
+      if (asyncflag && !multiproc)
+        error->all(FLERR,"Cannot use write_restart async "
+                   "without % in restart file name");
+      iarg += 2;
+
+    } else if (strcmp(arg[iarg],"fileper") == 0) {
       if (iarg+2 > narg) error->all(FLERR,"Illegal write_restart command");
       if (!multiproc)
         error->all(FLERR,"Cannot use write_restart fileper "
@@ -419,19 +502,76 @@ void WriteRestart::write(char *file)
     if (filewriter) {
       MPI_Status status;
       MPI_Request request;
+
+      // double-buffered gather: while one peer buffer is written to the
+      // file, the next peer's data is already in flight into the other,
+      // so the file system write and the MPI transfer overlap
+
+      double *buf2 = NULL;
+      if (nclusterprocs > 1)
+        memory->create(buf2,max_size,"write_restart:buf2");
+
+      // async mode: every proc owns its file, so the body write and
+      // close are handed to a helper thread and the step loop resumes
+
+#if defined(_OPENMP)
+      if (asyncflag && nclusterprocs == 1) {
+        RestartWriter *w = (RestartWriter *) awriter;
+        if (!w) {
+          w = new RestartWriter();
+          pthread_mutex_init(&w->lock,NULL);
+          pthread_cond_init(&w->work,NULL);
+          pthread_cond_init(&w->done,NULL);
+          w->pending = w->shutdown = 0;
+          pthread_create(&w->thread,NULL,restart_writer_run,w);
+          awriter = w;
+        }
+        pthread_mutex_lock(&w->lock);
+        while (w->pending) pthread_cond_wait(&w->done,&w->lock);
+        w->jobfp = fp;
+        w->jobflag = PERPROC;
+        w->jobn = send_size;
+        w->jobbuf = buf;
+        w->pending = 1;
+        pthread_cond_signal(&w->work);
+        pthread_mutex_unlock(&w->lock);
+        fp = NULL;
+        buf = NULL;          // thread owns and frees the snapshot
+      } else {
+#endif
+
+      double *wbuf = buf;
+      double *rbuf = buf2;
+
+      if (nclusterprocs > 1) {
+        MPI_Irecv(rbuf,max_size,MPI_DOUBLE,me+1,0,world,&request);
+        MPI_Send(&tmp,0,MPI_INT,me+1,0,world);
+      }
+      recv_size = send_size;
+
       for (int iproc = 0; iproc < nclusterprocs; iproc++) {
-        if (iproc) {
-          MPI_Irecv(buf,max_size,MPI_DOUBLE,me+iproc,0,world,&request);
-          MPI_Send(&tmp,0,MPI_INT,me+iproc,0,world);
+        write_double_vec(PERPROC,recv_size,wbuf);
+        if (iproc+1 < nclusterprocs) {
           MPI_Wait(&request,&status);
           MPI_Get_count(&status,MPI_DOUBLE,&recv_size);
-        } else recv_size = send_size;
-
-        write_double_vec(PERPROC,recv_size,buf);
+          double *swapbuf = wbuf;
+          wbuf = rbuf;
+          rbuf = swapbuf;
+          if (iproc+2 < nclusterprocs) {
+            MPI_Irecv(rbuf,max_size,MPI_DOUBLE,me+iproc+2,0,world,&request);
+            MPI_Send(&tmp,0,MPI_INT,me+iproc+2,0,world);
+          }
+        }
       }
       fclose(fp);
       fp = NULL;
 
+      memory->destroy(buf2);
+
+#if defined(_OPENMP)
+      }
+#endif
+
     } else {
       MPI_Recv(&tmp,0,MPI_INT,fileproc,0,world,MPI_STATUS_IGNORE);
       MPI_Rsend(buf,send_size,MPI_DOUBLE,fileproc,0,world);
@@ -440,7 +580,7 @@ void WriteRestart::write(char *file)
 
   // clean up
 
-  memory->destroy(buf);
+  if (buf) memory->destroy(buf);
 
   // invoke any fixes that write their own restart file
 
@@ -28,6 +28,7 @@ namespace LAMMPS_NS {
 class WriteRestart : protected Pointers {
  public:
   WriteRestart(class LAMMPS *);
+  ~WriteRestart();
   void command(int, char **);
   void multiproc_options(int, int, int, char **);
   void write(char *);
@@ -39,6 +40,8 @@ class WriteRestart : protected Pointers {
   int noinit;
 
   int multiproc;             // 0 = proc 0 writes for all
+  int asyncflag;            // 1 = per-proc bodies written by helper thread
+  void *awriter;            // opaque helper thread state
                              // else # of procs writing files
   int nclusterprocs;         // # of procs in my cluster that write to one file
   int filewriter;            // 1 if this proc writes a file, else 0